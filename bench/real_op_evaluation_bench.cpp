@@ -1,5 +1,15 @@
 #include <benchmark/benchmark.h>
 #include <benchmark_helpers.hpp>
+#include <real/sorting.hpp>
+#include <real/static_real.hpp>
+#include <real/real_vector.hpp>
+#include <real/exact_sum.hpp>
+#include <real/find_root.hpp>
+#include <real/real_input.hpp>
+#include <real/complex.hpp>
+#include <real/snapshot.hpp>
+#include <algorithm>
+#include <sstream>
 
 const int MIN_TREE_NODES = 10; 
 const int MAX_TREE_NODES = 10000;
@@ -113,4 +123,565 @@ BENCHMARK_CAPTURE(BM_RealComparisonEvaluation, GREATER_THAN, Comparison::GREATER
 
 BENCHMARK_CAPTURE(BM_RealComparisonEvaluation, EQUALS, Comparison::EQUALS)
     ->RangeMultiplier(MULTIPLIER_OE)->Range(MIN_NUM_DIGITS,MAX_NUM_DIGITS)->Unit(benchmark::kMillisecond)
-    ->Complexity();
\ No newline at end of file
+    ->Complexity();
+/// benchmarks operator> operator< and operator== for numbers a, b, with n digits, which differ
+/// in their first digit, so the floating-point filter decides without refining the numbers
+void BM_RealSeparatedComparisonEvaluation(benchmark::State& state, Comparison comp) {
+    for (auto i : state) {
+        state.PauseTiming(); // construct a, b
+        std::string tmp_a, tmp_b;
+        for (int i = 0; i < state.range(0); i++) { // we compare 111...1 and 211..1
+            tmp_a.push_back('1');
+            tmp_b.push_back(i == 0 ? '2' : '1');
+        }
+        boost::real::real<> a(tmp_a);
+        boost::real::real<> b(tmp_b);
+
+        state.ResumeTiming();
+
+        bool boo = realComp(a,b,comp); // evaluation
+        state.SetComplexityN(state.range(0));
+    }
+}
+
+BENCHMARK_CAPTURE(BM_RealSeparatedComparisonEvaluation, LESS_THAN, Comparison::LESS_THAN)
+    ->RangeMultiplier(MULTIPLIER_OE)->Range(MIN_NUM_DIGITS,MAX_NUM_DIGITS)
+    ->Complexity();
+
+BENCHMARK_CAPTURE(BM_RealSeparatedComparisonEvaluation, GREATER_THAN, Comparison::GREATER_THAN)
+    ->RangeMultiplier(MULTIPLIER_OE)->Range(MIN_NUM_DIGITS,MAX_NUM_DIGITS)
+    ->Complexity();
+
+BENCHMARK_CAPTURE(BM_RealSeparatedComparisonEvaluation, EQUALS, Comparison::EQUALS)
+    ->RangeMultiplier(MULTIPLIER_OE)->Range(MIN_NUM_DIGITS,MAX_NUM_DIGITS)
+    ->Complexity();
+
+/// benchmarks boost::real::compare against operator< for two different nodes of the same number
+/// a / b, which overlap at every precision: compare reports it, operator< throws
+void BM_RealUndecidedComparison(benchmark::State& state, bool use_compare) {
+    boost::real::real<> a = boost::real::real<>("1") / boost::real::real<>("3");
+    boost::real::real<> b = boost::real::real<>("2") / boost::real::real<>("6");
+    boost::real::precision_policy policy {(boost::real::precision_t) state.range(0)};
+    a.set_maximum_precision(state.range(0));
+    b.set_maximum_precision(state.range(0));
+
+    for (auto i : state) {
+        if (use_compare) {
+            benchmark::DoNotOptimize(boost::real::compare(a, b, policy));
+        } else {
+            try {
+                benchmark::DoNotOptimize(a < b);
+            } catch (const boost::real::precision_exception&) {}
+        }
+        state.SetComplexityN(state.range(0));
+    }
+}
+
+BENCHMARK_CAPTURE(BM_RealUndecidedComparison, COMPARE, true)
+    ->RangeMultiplier(2)->Range(1, 8)->Complexity();
+
+BENCHMARK_CAPTURE(BM_RealUndecidedComparison, OPERATOR, false)
+    ->RangeMultiplier(2)->Range(1, 8)->Complexity();
+
+/// benchmarks sorting the n numbers i % 1000 + 1 / (i + 1), which are all different, with
+/// boost::real::sort (true) or std::sort and operator< (false)
+void BM_RealSort(benchmark::State& state, bool use_real_sort) {
+    for (auto i : state) {
+        state.PauseTiming(); // construct the numbers, in reverse order
+        std::vector<boost::real::real<>> numbers;
+        for (int i = state.range(0); i > 0; i--) {
+            numbers.push_back(boost::real::real<>(std::to_string(i % 1000)) +
+                              boost::real::real<>("1") / boost::real::real<>(std::to_string(i + 1)));
+        }
+        state.ResumeTiming();
+
+        if (use_real_sort) {
+            boost::real::sort(numbers.begin(), numbers.end());
+        } else {
+            std::sort(numbers.begin(), numbers.end());
+        }
+        state.SetComplexityN(state.range(0));
+    }
+}
+
+BENCHMARK_CAPTURE(BM_RealSort, REAL_SORT, true)
+    ->RangeMultiplier(MULTIPLIER_TE)->Range(MIN_TREE_NODES, MAX_TREE_NODES)->Unit(benchmark::kMillisecond)
+    ->Complexity();
+
+BENCHMARK_CAPTURE(BM_RealSort, STD_SORT, false)
+    ->RangeMultiplier(MULTIPLIER_TE)->Range(MIN_TREE_NODES, MAX_TREE_NODES)->Unit(benchmark::kMillisecond)
+    ->Complexity();
+
+/// benchmarks evaluating to the maximum precision the sum of the n terms x * k - x * (k - 1),
+/// which is n * x, as written (false) or after boost::real::real::simplify (true)
+void BM_RealSimplifiedEvaluation(benchmark::State& state, bool simplify) {
+    for (auto i : state) {
+        state.PauseTiming(); // construct the number
+        boost::real::real<> x = boost::real::real<>("1") / boost::real::real<>("3");
+        boost::real::real<> sum("0");
+        for (int k = 1; k <= state.range(0); k++) {
+            sum = sum + (x * boost::real::real<>(std::to_string(k)) - x * boost::real::real<>(std::to_string(k - 1)));
+        }
+        state.ResumeTiming();
+
+        if (simplify) {
+            sum = sum.simplify();
+        }
+        sum.get_real_itr().cend(); // force evaluation
+        state.SetComplexityN(state.range(0));
+    }
+}
+
+BENCHMARK_CAPTURE(BM_RealSimplifiedEvaluation, SIMPLIFIED, true)
+    ->RangeMultiplier(MULTIPLIER_TE)->Range(MIN_TREE_NODES, MAX_TREE_NODES)->Unit(benchmark::kMillisecond)
+    ->Complexity();
+
+BENCHMARK_CAPTURE(BM_RealSimplifiedEvaluation, AS_WRITTEN, false)
+    ->RangeMultiplier(MULTIPLIER_TE)->Range(MIN_TREE_NODES, MAX_TREE_NODES)->Unit(benchmark::kMillisecond)
+    ->Complexity();
+
+/// benchmarks evaluating the sum of n copies of sin(x) * exp(x), each one built apart, with
+/// hash-consing enabled (true), so they are a single node, or disabled (false)
+void BM_RealHashConsing(benchmark::State& state, bool hash_consing) {
+    boost::real::node_table<int>::hash_consing = hash_consing;
+    for (auto i : state) {
+        state.PauseTiming(); // construct the number
+        boost::real::real<> sum("0");
+        for (int k = 0; k < state.range(0); k++) {
+            boost::real::real<> x = boost::real::real<>("1") / boost::real::real<>("3");
+            sum = sum + boost::real::real<>::sin(x) * boost::real::real<>::exp(x);
+        }
+        state.ResumeTiming();
+
+        sum.get_real_itr().cend(); // force evaluation
+        state.SetComplexityN(state.range(0));
+    }
+    boost::real::node_table<int>::hash_consing = false;
+}
+
+BENCHMARK_CAPTURE(BM_RealHashConsing, ENABLED, true)
+    ->RangeMultiplier(2)->Range(1, 16)->Unit(benchmark::kMillisecond)->Complexity();
+
+BENCHMARK_CAPTURE(BM_RealHashConsing, DISABLED, false)
+    ->RangeMultiplier(2)->Range(1, 16)->Unit(benchmark::kMillisecond)->Complexity();
+
+/// benchmarks evaluating the sum of the n terms rate * k, with rate the rational 1201/1200 and
+/// k explicit numbers, where every term is a single division of two explicit numbers
+void BM_RealMixedRationalEvaluation(benchmark::State& state) {
+    for (auto i : state) {
+        state.PauseTiming(); // construct the number
+        boost::real::real<> rate("1201/1200", "rational");
+        boost::real::real<> sum("0");
+        for (int k = 1; k <= state.range(0); k++) {
+            sum = sum + rate * boost::real::real<>(std::to_string(k));
+        }
+        state.ResumeTiming();
+
+        sum.get_real_itr().cend(); // force evaluation
+        state.SetComplexityN(state.range(0));
+    }
+}
+
+BENCHMARK(BM_RealMixedRationalEvaluation)
+    ->RangeMultiplier(2)->Range(1, 64)->Unit(benchmark::kMillisecond)->Complexity();
+
+/// benchmarks n steps of x = x / 2 + 1 / 3 evaluated to the maximum precision, with the
+/// automatic materialization at depth 8 (true) or with the whole tree (false)
+void BM_RealMaterializedIteration(benchmark::State& state, bool materialize) {
+    boost::real::node_table<int>::automatic_materialization = {materialize ? (size_t) 8 : 0, 0};
+    for (auto i : state) {
+        boost::real::real<> third = boost::real::real<>("1") / boost::real::real<>("3");
+        boost::real::real<> x("0");
+        for (int k = 0; k < state.range(0); k++) {
+            x = x / boost::real::real<>("2") + third;
+        }
+        x.get_real_itr().cend(); // force evaluation
+        state.SetComplexityN(state.range(0));
+    }
+    boost::real::node_table<int>::automatic_materialization = {};
+}
+
+BENCHMARK_CAPTURE(BM_RealMaterializedIteration, MATERIALIZED, true)
+    ->RangeMultiplier(2)->Range(8, 128)->Unit(benchmark::kMillisecond)->Complexity();
+
+BENCHMARK_CAPTURE(BM_RealMaterializedIteration, WHOLE_TREE, false)
+    ->RangeMultiplier(2)->Range(8, 128)->Unit(benchmark::kMillisecond)->Complexity();
+
+/// benchmarks the evaluation of a sum of n products of divisions to the maximum precision, with
+/// an enclosure cache of 1KB (true) or without a cache (false)
+void BM_RealEnclosureCache(benchmark::State& state, bool cached) {
+    boost::real::enclosure_cache<int>::set_capacity(cached ? 1024 : 0);
+    for (auto i : state) {
+        boost::real::real<> x("0");
+        for (int k = 0; k < state.range(0); k++) {
+            x = x + (boost::real::real<>("1") / boost::real::real<>(std::to_string(k + 2))) *
+                    (boost::real::real<>("1") / boost::real::real<>("3"));
+        }
+        x.get_real_itr().cend(); // force evaluation
+        state.SetComplexityN(state.range(0));
+    }
+    boost::real::enclosure_cache<int>::set_capacity(0);
+}
+
+BENCHMARK_CAPTURE(BM_RealEnclosureCache, CACHED, true)
+    ->RangeMultiplier(2)->Range(8, 64)->Unit(benchmark::kMillisecond)->Complexity();
+
+BENCHMARK_CAPTURE(BM_RealEnclosureCache, UNCACHED, false)
+    ->RangeMultiplier(2)->Range(8, 64)->Unit(benchmark::kMillisecond)->Complexity();
+
+/// benchmarks n single steps of an algorithmic number iterator, reading its interval once
+/// at the end (true) or after every step (false)
+void BM_RealLeafIteration(benchmark::State& state, bool read_once) {
+    boost::real::real<> x([] (unsigned int n) { return (int) (n % 9) + 1; }, 0);
+    for (auto i : state) {
+        auto it = x.get_real_itr();
+        for (int k = 0; k < state.range(0); k++) {
+            ++it;
+            if (!read_once) {
+                benchmark::DoNotOptimize(it.get_interval());
+            }
+        }
+        benchmark::DoNotOptimize(it.get_interval());
+        state.SetComplexityN(state.range(0));
+    }
+}
+
+BENCHMARK_CAPTURE(BM_RealLeafIteration, READ_ONCE, true)
+    ->RangeMultiplier(2)->Range(64, 1024)->Unit(benchmark::kMicrosecond)->Complexity();
+
+BENCHMARK_CAPTURE(BM_RealLeafIteration, READ_EVERY_STEP, false)
+    ->RangeMultiplier(2)->Range(64, 1024)->Unit(benchmark::kMicrosecond)->Complexity();
+
+/// benchmarks the sum of 1 / k for k in [1, n] at 256 bits, on intervals (true) or
+/// on a lazy number evaluated to the same precision (false)
+void BM_IntervalArithmetic(benchmark::State& state, bool intervals) {
+    for (auto i : state) {
+        if (intervals) {
+            auto one = boost::real::real<>("1").get_real_itr().cend().get_interval();
+            boost::real::interval<int> sum;
+            for (int k = 1; k <= state.range(0); k++) {
+                auto term = boost::real::real<>(std::to_string(k)).get_real_itr().cend().get_interval();
+                sum = boost::real::add(sum, boost::real::div(one, term, 256), 256);
+            }
+            benchmark::DoNotOptimize(sum);
+        } else {
+            boost::real::real<> sum("0");
+            for (int k = 1; k <= state.range(0); k++) {
+                sum = sum + boost::real::real<>("1") / boost::real::real<>(std::to_string(k));
+            }
+            sum.get_real_itr().refine_to_bits(256);
+        }
+        state.SetComplexityN(state.range(0));
+    }
+}
+
+BENCHMARK_CAPTURE(BM_IntervalArithmetic, INTERVALS, true)
+    ->RangeMultiplier(2)->Range(8, 128)->Unit(benchmark::kMillisecond)->Complexity();
+
+BENCHMARK_CAPTURE(BM_IntervalArithmetic, LAZY, false)
+    ->RangeMultiplier(2)->Range(8, 128)->Unit(benchmark::kMillisecond)->Complexity();
+
+/// benchmarks n multiply-adds of 1 - 1 / base^4 by itself, on a static_real of 4 digits (true)
+/// or on a lazy number evaluated to the same precision (false)
+void BM_StaticReal(benchmark::State& state, bool fixed) {
+    int base = (std::numeric_limits<int>::max() / 4) * 2 - 1;
+    boost::real::exact_number<int> x(std::vector<int> {base, base, base, base}, 0);
+    for (auto i : state) {
+        if (fixed) {
+            boost::real::static_real<4> factor(x, boost::real::ROUNDING::DOWNWARD);
+            boost::real::static_real<4> sum(0, boost::real::ROUNDING::DOWNWARD);
+            for (int k = 0; k < state.range(0); k++) {
+                sum = sum * factor + factor;
+            }
+            benchmark::DoNotOptimize(sum);
+        } else {
+            boost::real::real<> factor({base, base, base, base}, 0);
+            boost::real::real<> sum("0");
+            for (int k = 0; k < state.range(0); k++) {
+                sum = sum * factor + factor;
+            }
+            auto it = sum.get_real_itr();
+            it.iterate_n_times(4);
+            benchmark::DoNotOptimize(it.get_interval());
+        }
+        state.SetComplexityN(state.range(0));
+    }
+}
+
+BENCHMARK_CAPTURE(BM_StaticReal, STATIC, true)
+    ->RangeMultiplier(2)->Range(8, 128)->Unit(benchmark::kMicrosecond)->Complexity();
+
+BENCHMARK_CAPTURE(BM_StaticReal, LAZY, false)
+    ->RangeMultiplier(2)->Range(8, 128)->Unit(benchmark::kMicrosecond)->Complexity();
+
+/// benchmarks the evaluation of 1 / k + k / 3 at 128 bits for k in [1, n], on a real_vector (true)
+/// or on a real number per row (false)
+void BM_RealVector(benchmark::State& state, bool batch) {
+    std::vector<boost::real::real<>> column;
+    for (int k = 1; k <= state.range(0); k++) {
+        column.push_back(boost::real::real<>(std::to_string(k)));
+    }
+    for (auto i : state) {
+        if (batch) {
+            boost::real::real_vector<> k(column);
+            auto expression = boost::real::real<>("1") / k + k / boost::real::real<>("3");
+            benchmark::DoNotOptimize(expression.evaluate(128));
+        } else {
+            for (auto k : column) {
+                boost::real::real<> row = boost::real::real<>("1") / k + k / boost::real::real<>("3");
+                row.get_real_itr().refine_to_bits(128);
+            }
+        }
+        state.SetComplexityN(state.range(0));
+    }
+}
+
+BENCHMARK_CAPTURE(BM_RealVector, BATCH, true)
+    ->RangeMultiplier(4)->Range(16, 1024)->Unit(benchmark::kMillisecond)->Complexity();
+
+BENCHMARK_CAPTURE(BM_RealVector, PER_ROW, false)
+    ->RangeMultiplier(4)->Range(16, 1024)->Unit(benchmark::kMillisecond)->Complexity();
+
+/// benchmarks the sum of n numbers of 4 digits with different exponents, with an exact_accumulator
+/// (true) or with the exact_number addition (false)
+void BM_ExactSum(benchmark::State& state, bool accumulator) {
+    std::vector<boost::real::exact_number<int>> numbers;
+    for (int k = 0; k < state.range(0); k++) {
+        numbers.push_back(boost::real::exact_number<int>(std::vector<int> {k + 1, 2 * k + 1, 3 * k + 1, 4 * k + 1}, k % 7 - 3, k % 2 == 0));
+    }
+    for (auto i : state) {
+        if (accumulator) {
+            benchmark::DoNotOptimize(boost::real::exact_sum(numbers));
+        } else {
+            boost::real::exact_number<int> sum;
+            for (const auto& x : numbers) {
+                sum = sum + x;
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetComplexityN(state.range(0));
+    }
+}
+
+BENCHMARK_CAPTURE(BM_ExactSum, ACCUMULATOR, true)
+    ->RangeMultiplier(4)->Range(64, 16384)->Unit(benchmark::kMicrosecond)->Complexity();
+
+BENCHMARK_CAPTURE(BM_ExactSum, ADDITIONS, false)
+    ->RangeMultiplier(4)->Range(64, 16384)->Unit(benchmark::kMicrosecond)->Complexity();
+
+/// benchmarks the refinement to 256 bits of the polynomial of degree n with coefficients 1 / (k + 1)
+/// at 1 / 3, as a POLYNOMIAL node (true) or as a tree of additions and multiplications (false)
+void BM_RealPolynomial(benchmark::State& state, bool node) {
+    for (auto i : state) {
+        boost::real::real<> x = boost::real::real<>("1") / boost::real::real<>("3");
+        std::vector<boost::real::real<>> coefficients;
+        for (int k = 0; k <= state.range(0); k++) {
+            coefficients.push_back(boost::real::real<>("1") / boost::real::real<>(std::to_string(k + 1)));
+        }
+        boost::real::real<> p("0");
+        if (node) {
+            p = boost::real::polyval(coefficients, x);
+        } else {
+            for (int k = state.range(0); k >= 0; k--) {
+                p = p * x + coefficients[k];
+            }
+        }
+        p.get_real_itr().refine_to_bits(256);
+        state.SetComplexityN(state.range(0));
+    }
+}
+
+BENCHMARK_CAPTURE(BM_RealPolynomial, POLYNOMIAL, true)
+    ->RangeMultiplier(2)->Range(4, 64)->Unit(benchmark::kMillisecond)->Complexity();
+
+BENCHMARK_CAPTURE(BM_RealPolynomial, TREE, false)
+    ->RangeMultiplier(2)->Range(4, 64)->Unit(benchmark::kMillisecond)->Complexity();
+
+/// benchmarks the refinement to n bits of the square root of 2, found by find_root (true) or by a
+/// bisection of the bracket on exact midpoints, one bit per step (false)
+void BM_FindRoot(benchmark::State& state, bool newton) {
+    for (auto i : state) {
+        boost::real::real<> two("2");
+        boost::real::real<> root("0");
+        if (newton) {
+            root = boost::real::find_root([two] (boost::real::real<> x) { return x * x - two; },
+                                          [] (boost::real::real<> x) { return boost::real::real<>("2") * x; },
+                                          boost::real::real<>("1"), boost::real::real<>("2"));
+        } else {
+            // exact midpoints, so that the comparisons do not build a growing tree
+            boost::real::exact_number<int> lower(std::vector<int> {1}, 1);
+            boost::real::exact_number<int> upper(std::vector<int> {2}, 1);
+            boost::real::exact_number<int> square(std::vector<int> {2}, 1);
+            boost::real::exact_number<int> half(std::vector<int> {std::numeric_limits<int>::max() / 4}, 0);
+            for (int k = 0; k < state.range(0); k++) {
+                boost::real::exact_number<int> middle = (lower + upper) * half;
+                if (middle * middle < square) {
+                    lower = middle;
+                } else {
+                    upper = middle;
+                }
+            }
+            root = boost::real::real<>(boost::real::real_explicit<int>(lower));
+        }
+        root.get_real_itr().refine_to_bits(state.range(0));
+        state.SetComplexityN(state.range(0));
+    }
+}
+
+BENCHMARK_CAPTURE(BM_FindRoot, NEWTON, true)
+    ->RangeMultiplier(2)->Range(32, 256)->Unit(benchmark::kMillisecond)->Complexity();
+
+BENCHMARK_CAPTURE(BM_FindRoot, BISECTION, false)
+    ->RangeMultiplier(2)->Range(32, 256)->Unit(benchmark::kMillisecond)->Complexity();
+
+/// benchmarks the refinement to 256 bits of n steps of the logistic map x = 3 x (1 - x), with the
+/// centered forms enabled (true) or disabled (false)
+void BM_CenteredForm(benchmark::State& state, bool centered) {
+    boost::real::centered_form<int>::enabled = centered;
+    for (auto i : state) {
+        boost::real::real<> x = boost::real::real<>("1") / boost::real::real<>("3");
+        for (int k = 0; k < state.range(0); k++) {
+            x = boost::real::real<>("3") * x * (boost::real::real<>("1") - x);
+        }
+        x.get_real_itr().refine_to_bits(256);
+        state.SetComplexityN(state.range(0));
+    }
+    boost::real::centered_form<int>::enabled = false;
+}
+
+BENCHMARK_CAPTURE(BM_CenteredForm, CENTERED, true)
+    ->RangeMultiplier(2)->Range(4, 32)->Unit(benchmark::kMillisecond)->Complexity();
+
+BENCHMARK_CAPTURE(BM_CenteredForm, NAIVE, false)
+    ->RangeMultiplier(2)->Range(4, 32)->Unit(benchmark::kMillisecond)->Complexity();
+
+/// benchmarks the evaluation to 256 bits of the sum of n products c_k * x_k of constants with
+/// inputs, after one input changes: with a real_input (true) or by building the sum again (false)
+void BM_RealInput(benchmark::State& state, bool input) {
+    std::vector<boost::real::real<>> constants;
+    std::vector<boost::real::real_input<>> inputs;
+    for (int k = 0; k < state.range(0); k++) {
+        constants.push_back(boost::real::real<>("1") / boost::real::real<>(std::to_string(k + 3)));
+        inputs.emplace_back(std::to_string(k + 1));
+    }
+    boost::real::real<> sum("0");
+    for (int k = 0; k < state.range(0); k++) {
+        sum = sum + constants[k] * inputs[k];
+    }
+    sum.get_real_itr().refine_to_bits(256);
+
+    int value = 1;
+    for (auto i : state) {
+        value++;
+        if (input) {
+            inputs[0].set(std::to_string(value));
+            sum.get_real_itr().refine_to_bits(256);
+        } else {
+            boost::real::real<> rebuilt("0");
+            for (int k = 0; k < state.range(0); k++) {
+                boost::real::real<> c = boost::real::real<>("1") / boost::real::real<>(std::to_string(k + 3));
+                rebuilt = rebuilt + c * boost::real::real<>(std::to_string(k == 0 ? value : k + 1));
+            }
+            rebuilt.get_real_itr().refine_to_bits(256);
+        }
+        state.SetComplexityN(state.range(0));
+    }
+}
+
+BENCHMARK_CAPTURE(BM_RealInput, INPUT, true)
+    ->RangeMultiplier(4)->Range(4, 256)->Unit(benchmark::kMillisecond)->Complexity();
+
+BENCHMARK_CAPTURE(BM_RealInput, REBUILD, false)
+    ->RangeMultiplier(4)->Range(4, 256)->Unit(benchmark::kMillisecond)->Complexity();
+
+/// benchmarks the refinement to n bits of x - 0.333 at x = 1 / 3 as a user defined function with a
+/// Lipschitz constant (true), which plans the precision of x, or without one (false)
+void BM_RealFunction(benchmark::State& state, bool lipschitz) {
+    boost::real::interval<int> constant;
+    constant.lower_bound = constant.upper_bound = boost::real::real<>("0.333").get_real_itr().cend().get_interval().lower_bound;
+    boost::real::real_function<int> shift;
+    shift.kernel = [constant] (const boost::real::interval<int>& x, size_t bits) {
+        return boost::real::sub(x, constant, bits);
+    };
+    if (lipschitz) {
+        shift.lipschitz = boost::real::exact_number<int>(std::vector<int> {1}, 1);
+    }
+    for (auto i : state) {
+        boost::real::real<> y = boost::real::apply(shift, boost::real::real<>("1") / boost::real::real<>("3"));
+        y.get_real_itr().refine_to_bits(state.range(0));
+        state.SetComplexityN(state.range(0));
+    }
+}
+
+BENCHMARK_CAPTURE(BM_RealFunction, LIPSCHITZ, true)
+    ->RangeMultiplier(2)->Range(64, 1024)->Unit(benchmark::kMicrosecond)->Complexity();
+
+BENCHMARK_CAPTURE(BM_RealFunction, KERNEL_ONLY, false)
+    ->RangeMultiplier(2)->Range(64, 1024)->Unit(benchmark::kMicrosecond)->Complexity();
+
+/// benchmarks the refinement to n bits of the product of (1 / 3 + i / 7) and (2 / 3 - i / 11) as a
+/// fused complex product (true), or as the four real products of its parts (false)
+void BM_Complex(benchmark::State& state, bool fused) {
+    for (auto i : state) {
+        boost::real::real<> a = boost::real::real<>("1") / boost::real::real<>("3");
+        boost::real::real<> b = boost::real::real<>("1") / boost::real::real<>("7");
+        boost::real::real<> c = boost::real::real<>("2") / boost::real::real<>("3");
+        boost::real::real<> d = boost::real::real<>("-1") / boost::real::real<>("11");
+        if (fused) {
+            boost::real::complex<> z = boost::real::complex<>(a, b) * boost::real::complex<>(c, d);
+            z.enclosure(state.range(0));
+        } else {
+            boost::real::real<> real_part = a * c - b * d;
+            boost::real::real<> imaginary_part = a * d + b * c;
+            real_part.get_real_itr().refine_to_bits(state.range(0));
+            imaginary_part.get_real_itr().refine_to_bits(state.range(0));
+        }
+        state.SetComplexityN(state.range(0));
+    }
+}
+
+BENCHMARK_CAPTURE(BM_Complex, FUSED, true)
+    ->RangeMultiplier(2)->Range(64, 1024)->Unit(benchmark::kMicrosecond)->Complexity();
+
+BENCHMARK_CAPTURE(BM_Complex, PARTS, false)
+    ->RangeMultiplier(2)->Range(64, 1024)->Unit(benchmark::kMicrosecond)->Complexity();
+
+/// benchmarks one more digit of the sum of 1 / k for k = 1..n, after 6 digits, resumed from a
+/// snapshot of that evaluation (true), or built and evaluated again (false)
+void BM_Snapshot(benchmark::State& state, bool resume) {
+    auto harmonic = [&state] () {
+        boost::real::real<> sum("0");
+        for (int k = 1; k <= state.range(0); k++) {
+            sum = sum + boost::real::real<>("1") / boost::real::real<>(std::to_string(k));
+        }
+        return sum;
+    };
+    boost::real::real<> evaluated = harmonic();
+    for (int k = 0; k < 6; k++) {
+        evaluated.refine();
+    }
+    std::stringstream checkpoint(std::ios::in | std::ios::out | std::ios::binary);
+    boost::real::snapshot<int>::write(checkpoint, evaluated);
+    std::string bytes = checkpoint.str();
+
+    for (auto i : state) {
+        boost::real::real<> x;
+        if (resume) {
+            std::stringstream stream(bytes, std::ios::in | std::ios::binary);
+            x = boost::real::snapshot<int>::read(stream);
+        } else {
+            x = harmonic();
+            for (int k = 0; k < 6; k++) {
+                x.refine();
+            }
+        }
+        x.refine();
+        state.SetComplexityN(state.range(0));
+    }
+}
+
+BENCHMARK_CAPTURE(BM_Snapshot, RESUME, true)
+    ->RangeMultiplier(4)->Range(16, 1024)->Unit(benchmark::kMillisecond)->Complexity();
+
+BENCHMARK_CAPTURE(BM_Snapshot, REBUILD, false)
+    ->RangeMultiplier(4)->Range(16, 1024)->Unit(benchmark::kMillisecond)->Complexity();
@@ -0,0 +1,33 @@
+#ifndef BOOST_REAL_APPROXIMATION_HPP
+#define BOOST_REAL_APPROXIMATION_HPP
+
+#include <real/interval.hpp>
+#include <real/const_precision_iterator.hpp>
+
+namespace boost {
+    namespace real {
+
+        /**
+         * @brief Selects how the tolerance given to boost::real::real::approximate is interpreted.
+         *
+         * ABSOLUTE: the enclosure width must be at most eps.
+         * RELATIVE: the enclosure width must be at most eps * |x|, where |x| is bounded from below
+         * by the enclosure boundary closest to zero.
+         */
+        enum class TOLERANCE{ABSOLUTE, RELATIVE};
+
+        /**
+         * @brief The result of a targeted-accuracy evaluation: an enclosure of the number which
+         * satisfies the requested tolerance, together with the precision the iterator reached to
+         * obtain it, both in digits and in bits.
+         */
+        template <typename T = int>
+        struct approximation {
+            interval<T> enclosure;
+            precision_t precision;
+            precision_t precision_bits;
+        };
+    }
+}
+
+#endif // BOOST_REAL_APPROXIMATION_HPP
@@ -0,0 +1,256 @@
+#ifndef BOOST_REAL_CENTERED_FORM_HPP
+#define BOOST_REAL_CENTERED_FORM_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+#include <real/interval.hpp>
+#include <real/interval_arithmetic.hpp>
+
+namespace boost {
+    namespace real {
+
+        // fwd decl
+        template <typename T>
+        class real_data;
+
+        template <typename T>
+        class real_operation;
+
+        /**
+         * @brief Mean value forms for the operations whose operands share nodes.
+         *
+         * The interval of an operation is computed from the intervals of its operands as if they were
+         * independent, so an expression using a node twice, such as x * (1 - x) or x - x * x,
+         * overestimates its range by the width of x, and the iterators refine much further than the
+         * condition of the expression requires. When enabled, the additions, subtractions,
+         * multiplications and divisions whose subtree reaches a node by more than one path are
+         * evaluated again on dual intervals: the value at the midpoints of the shared nodes, and the
+         * enclosures of the partial derivatives with respect to them. The interval of the operation is
+         * then intersected with the mean value form
+         *
+         *     f(m) + sum_i df/dx_i(X) * (X_i - m_i)
+         *
+         * whose width shrinks with the square of the widths of the shared nodes X_i. Other operations
+         * and the nodes reached once are the constants of the form, taken at their intervals.
+         *
+         * It is disabled by default. It is not thread safe.
+         */
+        template <typename T = int>
+        class centered_form {
+            // a node evaluated at the midpoints of the shared nodes and over their intervals
+            struct dual {
+                interval<T> value;
+                interval<T> range;
+                // the partial derivatives with respect to the shared nodes, over their intervals
+                std::vector<interval<T>> slopes;
+            };
+
+            using parents_map = std::unordered_map<real_data<T>*, size_t>;
+            using variables_map = std::unordered_map<real_data<T>*, size_t>;
+            using duals_map = std::unordered_map<real_data<T>*, std::optional<dual>>;
+
+            static const real_operation<T>* differentiable(real_data<T>* x) {
+                const real_operation<T>* ro = std::get_if<real_operation<T>>(x->get_real_ptr());
+                if (ro == nullptr || x->input()) {
+                    return nullptr;
+                }
+                switch (ro->get_operation()) {
+                    case OPERATION::ADDITION:
+                    case OPERATION::SUBTRACTION:
+                    case OPERATION::MULTIPLICATION:
+                    case OPERATION::DIVISION:
+                        return ro;
+                    default:
+                        return nullptr;
+                }
+            }
+
+            static bool contains_zero(const interval<T>& x) {
+                return (!x.positive() && !x.negative()) || x.lower_bound == literals::zero_exact<T> ||
+                       x.upper_bound == literals::zero_exact<T>;
+            }
+
+            static interval<T> point(const exact_number<T>& x) {
+                interval<T> result;
+                result.lower_bound = result.upper_bound = x;
+                return result;
+            }
+
+            /// counts the parents of the nodes of the subtree of x, false if it has more than maximum_nodes
+            static bool count_parents(real_data<T>* x, parents_map& parents) {
+                if (parents[x]++ > 0) {
+                    return true;
+                }
+                if (parents.size() > maximum_nodes) {
+                    return false;
+                }
+                const real_operation<T>* ro = differentiable(x);
+                if (ro == nullptr) {
+                    return true;
+                }
+                return count_parents(ro->lhs().get(), parents) && count_parents(ro->rhs().get(), parents);
+            }
+
+            static std::optional<dual> evaluate(real_data<T>* x, const variables_map& variables, duals_map& duals, size_t bits) {
+                auto found = duals.find(x);
+                if (found != duals.end()) {
+                    return found->second;
+                }
+
+                std::optional<dual> result;
+                const interval<T>& range = x->get_precision_itr().get_interval();
+                auto variable = variables.find(x);
+                const real_operation<T>* ro = differentiable(x);
+
+                if (variable != variables.end() || ro == nullptr) {
+                    interval<T> zero = point(literals::zero_exact<T>);
+                    result = dual {range, range, std::vector<interval<T>>(variables.size(), zero)};
+                    if (variable != variables.end()) {
+                        // the midpoint is exact, since the base is even
+                        exact_number<T> half(std::vector<T> {(std::numeric_limits<T>::max() / 4)}, 0);
+                        exact_number<T> middle = (range.lower_bound + range.upper_bound) * half;
+                        middle.normalize();
+                        result->value = point(middle);
+                        result->slopes[variable->second] = point(exact_number<T>(std::vector<T> {1}, 1));
+                    }
+                } else {
+                    std::optional<dual> lhs = evaluate(ro->lhs().get(), variables, duals, bits);
+                    std::optional<dual> rhs = evaluate(ro->rhs().get(), variables, duals, bits);
+                    if (lhs && rhs) {
+                        result = combine(ro->get_operation(), *lhs, *rhs, bits);
+                    }
+                }
+                duals[x] = result;
+                return result;
+            }
+
+            static std::optional<dual> combine(OPERATION operation, const dual& lhs, const dual& rhs, size_t bits) {
+                dual result;
+                result.slopes.reserve(lhs.slopes.size());
+                switch (operation) {
+                    case OPERATION::ADDITION:
+                        result.value = add(lhs.value, rhs.value, bits);
+                        result.range = add(lhs.range, rhs.range, bits);
+                        for (size_t i = 0; i < lhs.slopes.size(); i++) {
+                            result.slopes.push_back(add(lhs.slopes[i], rhs.slopes[i], bits));
+                        }
+                        break;
+
+                    case OPERATION::SUBTRACTION:
+                        result.value = sub(lhs.value, rhs.value, bits);
+                        result.range = sub(lhs.range, rhs.range, bits);
+                        for (size_t i = 0; i < lhs.slopes.size(); i++) {
+                            result.slopes.push_back(sub(lhs.slopes[i], rhs.slopes[i], bits));
+                        }
+                        break;
+
+                    case OPERATION::MULTIPLICATION:
+                        // (uv)' = u'v + uv'
+                        result.value = mul(lhs.value, rhs.value, bits);
+                        result.range = mul(lhs.range, rhs.range, bits);
+                        for (size_t i = 0; i < lhs.slopes.size(); i++) {
+                            result.slopes.push_back(add(mul(lhs.slopes[i], rhs.range, bits),
+                                                        mul(lhs.range, rhs.slopes[i], bits), bits));
+                        }
+                        break;
+
+                    case OPERATION::DIVISION:
+                        // (u/v)' = (u' - (u/v)v') / v
+                        if (contains_zero(rhs.value) || contains_zero(rhs.range)) {
+                            return std::nullopt;
+                        }
+                        result.value = div(lhs.value, rhs.value, bits);
+                        result.range = div(lhs.range, rhs.range, bits);
+                        for (size_t i = 0; i < lhs.slopes.size(); i++) {
+                            result.slopes.push_back(div(sub(lhs.slopes[i], mul(result.range, rhs.slopes[i], bits), bits),
+                                                        rhs.range, bits));
+                        }
+                        break;
+
+                    default:
+                        return std::nullopt;
+                }
+                return result;
+            }
+
+        public:
+
+            /// if true, the operations intervals are narrowed by their mean value form. It is false by default.
+            inline static bool enabled = false;
+
+            /// the subtrees with more nodes are not evaluated on dual intervals
+            inline static size_t maximum_nodes = 64;
+
+            /**
+             * @brief Intersects the interval of x, the operation of the node, with its mean value
+             * form at the precision in bits, if its subtree reaches a node by more than one path.
+             * The operands must have been evaluated already.
+             */
+            static void narrow(interval<T>& enclosure, const real_operation<T>& x, size_t bits) {
+                switch (x.get_operation()) {
+                    case OPERATION::ADDITION:
+                    case OPERATION::SUBTRACTION:
+                    case OPERATION::MULTIPLICATION:
+                    case OPERATION::DIVISION:
+                        break;
+                    default:
+                        return;
+                }
+
+                parents_map parents;
+                if (!count_parents(x.lhs().get(), parents) || !count_parents(x.rhs().get(), parents)) {
+                    return;
+                }
+
+                // the shared nodes whose intervals are not a single number are the variables
+                variables_map variables;
+                for (const auto& [node, count] : parents) {
+                    if (count > 1 && !node->get_precision_itr().get_interval().is_a_number()) {
+                        variables.emplace(node, variables.size());
+                    }
+                }
+                if (variables.empty()) {
+                    return;
+                }
+
+                duals_map duals;
+                std::optional<dual> lhs = evaluate(x.lhs().get(), variables, duals, bits);
+                std::optional<dual> rhs = evaluate(x.rhs().get(), variables, duals, bits);
+                if (!lhs || !rhs) {
+                    return;
+                }
+                std::optional<dual> result = combine(x.get_operation(), *lhs, *rhs, bits);
+                if (!result) {
+                    return;
+                }
+
+                interval<T> centered = result->value;
+                for (const auto& [node, index] : variables) {
+                    // the shared nodes below another shared node are not reached, their slopes are zero
+                    auto variable = duals.find(node);
+                    if (variable == duals.end()) {
+                        continue;
+                    }
+                    const interval<T>& range = node->get_precision_itr().get_interval();
+                    interval<T> offset = sub(range, point(variable->second->value.lower_bound), bits);
+                    centered = add(centered, mul(result->slopes[index], offset, bits), bits);
+                }
+
+                exact_number<T> lower = std::max(enclosure.lower_bound, centered.lower_bound);
+                exact_number<T> upper = std::min(enclosure.upper_bound, centered.upper_bound);
+                if (!(upper < lower)) {
+                    enclosure.lower_bound = lower;
+                    enclosure.upper_bound = upper;
+                }
+            }
+        };
+    }
+}
+
+#endif // BOOST_REAL_CENTERED_FORM_HPP
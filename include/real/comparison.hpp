@@ -0,0 +1,36 @@
+#ifndef BOOST_REAL_COMPARISON_HPP
+#define BOOST_REAL_COMPARISON_HPP
+
+#include <real/const_precision_iterator.hpp>
+
+namespace boost {
+    namespace real {
+
+        /**
+         * @brief The outcome of boost::real::compare. UNDECIDED means that the approximation
+         * intervals still overlap at the maximum precision allowed by the policy, which is a normal
+         * result and not an error.
+         */
+        enum class ORDER{LESS, EQUAL, GREATER, UNDECIDED};
+
+        /**
+         * @brief Limits the refinement done by boost::real::compare. A maximum precision of zero
+         * uses the greatest maximum precision of the compared numbers, as the comparison operators do.
+         */
+        struct precision_policy {
+            precision_t maximum_precision = 0;
+        };
+
+        /**
+         * @brief The result of boost::real::compare: the order of the numbers and the precision,
+         * in digits, the numbers were refined to. The precision is zero when the floating-point
+         * enclosures were enough to decide the order.
+         */
+        struct comparison {
+            ORDER order;
+            precision_t precision;
+        };
+    }
+}
+
+#endif // BOOST_REAL_COMPARISON_HPP
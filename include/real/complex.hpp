@@ -0,0 +1,308 @@
+#ifndef BOOST_REAL_COMPLEX_HPP
+#define BOOST_REAL_COMPLEX_HPP
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <real/real.hpp>
+#include <real/interval_arithmetic.hpp>
+
+namespace boost {
+    namespace real {
+
+        /// a rectangular enclosure of a complex number, an interval for each part
+        template <typename T = int>
+        struct complex_interval {
+            interval<T> real_part;
+            interval<T> imaginary_part;
+
+            /// true if both parts are tight to the precision in bits, see interval::tight
+            bool tight(size_t bits) const {
+                return real_part.tight(bits) && imaginary_part.tight(bits);
+            }
+        };
+
+        /// a disk of the complex plane which contains a complex number
+        template <typename T = int>
+        struct complex_ball {
+            exact_number<T> real_center;
+            exact_number<T> imaginary_center;
+            exact_number<T> radius;
+        };
+
+        namespace complex_detail {
+
+            /// encloses x^2, which is not negative even if x contains zero
+            template <typename T>
+            interval<T> square(const interval<T>& x, size_t bits) {
+                interval<T> result = mul(x, x, bits);
+                if (!result.lower_bound.positive) {
+                    result.lower_bound = literals::zero_exact<T>;
+                }
+                return result;
+            }
+        }
+
+        /**
+         * @brief encloses x * y with three real multiplications, rounded outward to bits significant
+         * bits: for x = a + bi and y = c + di,
+         *
+         *     k1 = c (a + b),  k2 = a (d - c),  k3 = b (c + d),  x * y = (k1 - k3) + (k1 + k2) i
+         */
+        template <typename T>
+        complex_interval<T> mul(const complex_interval<T>& x, const complex_interval<T>& y, size_t bits) {
+            const interval<T>& a = x.real_part;
+            const interval<T>& b = x.imaginary_part;
+            const interval<T>& c = y.real_part;
+            const interval<T>& d = y.imaginary_part;
+
+            interval<T> k1 = mul(c, add(a, b, bits), bits);
+            interval<T> k2 = mul(a, sub(d, c, bits), bits);
+            interval<T> k3 = mul(b, add(c, d, bits), bits);
+            return complex_interval<T> {sub(k1, k3, bits), add(k1, k2, bits)};
+        }
+
+        /**
+         * @brief encloses x / y, rounded outward to bits significant bits: x times the conjugate of
+         * y, whose parts are divided by the shared denominator |y|^2
+         *
+         * @throws boost::real::divergent_division_result_exception if |y|^2 contains zero.
+         */
+        template <typename T>
+        complex_interval<T> div(const complex_interval<T>& x, const complex_interval<T>& y, size_t bits) {
+            interval<T> denominator = add(complex_detail::square(y.real_part, bits),
+                                          complex_detail::square(y.imaginary_part, bits), bits);
+            complex_interval<T> conjugate {y.real_part, sub(interval<T>(), y.imaginary_part, bits)};
+
+            complex_interval<T> numerator = mul(x, conjugate, bits);
+            return complex_interval<T> {div(numerator.real_part, denominator, bits),
+                                        div(numerator.imaginary_part, denominator, bits)};
+        }
+
+        /// encloses e^x = e^a (cos b + i sin b) for x = a + bi, rounded outward to bits significant bits
+        template <typename T>
+        complex_interval<T> exp(const complex_interval<T>& x, size_t bits) {
+            interval<T> modulus = exp(x.real_part, bits);
+            auto [sin, cos] = sin_cos(x.imaginary_part, bits);
+            return complex_interval<T> {mul(modulus, cos, bits), mul(modulus, sin, bits)};
+        }
+
+        namespace complex_detail {
+
+            /**
+             * @brief The state of a complex operation, shared by the iterators of the two leaves of its
+             * parts: the iterators of the operands parts and the narrowest enclosure of the result
+             * found so far, so both parts are computed by a single evaluation of the kernel.
+             */
+            template <typename T>
+            class fused {
+                OPERATION _operation;
+                // the real and imaginary parts of the operands
+                std::vector<const_precision_iterator<T>> _operands;
+                complex_interval<T> _enclosure;
+                // the precision the enclosure is tight to
+                size_t _bits = 0;
+                // the precision of the last evaluation, doubled when the result is not tight enough
+                size_t _working_bits = 2 * exact_number<T>::BITS_PER_DIGIT;
+                size_t _maximum_bits = std::numeric_limits<size_t>::max();
+
+                complex_interval<T> evaluate(size_t bits) {
+                    for (const_precision_iterator<T>& it : _operands) {
+                        it.refine_to_bits(bits);
+                    }
+                    complex_interval<T> x {_operands[0].get_interval(), _operands[1].get_interval()};
+                    switch (_operation) {
+                        case OPERATION::MULTIPLICATION:
+                            return mul(x, complex_interval<T> {_operands[2].get_interval(), _operands[3].get_interval()}, bits);
+                        case OPERATION::DIVISION:
+                            return div(x, complex_interval<T> {_operands[2].get_interval(), _operands[3].get_interval()}, bits);
+                        default:
+                            return exp(x, bits);
+                    }
+                }
+
+            public:
+
+                fused(OPERATION operation, const std::vector<real<T>>& operands) : _operation(operation) {
+                    for (const real<T>& operand : operands) {
+                        _operands.push_back(operand.get_real_itr());
+                        _maximum_bits = std::min(_maximum_bits,
+                            (size_t) _operands.back().maximum_precision() * exact_number<T>::BITS_PER_DIGIT);
+                    }
+                }
+
+                /**
+                 * @brief Evaluates the kernel until both parts are tight to the precision in bits, with
+                 * the operands refined to a digit above bits, then to twice the working precision
+                 * while the result is not tight enough or a divisor contains zero.
+                 *
+                 * @throws boost::real::divergent_division_result_exception if a divisor still contains
+                 * zero at the maximum precision of the operands.
+                 */
+                const complex_interval<T>& refine(size_t bits) {
+                    if (bits <= _bits) {
+                        return _enclosure;
+                    }
+                    size_t working_bits = std::max(_working_bits,
+                        std::min(bits + exact_number<T>::BITS_PER_DIGIT, _maximum_bits));
+                    while (true) {
+                        try {
+                            _enclosure = evaluate(working_bits);
+                            if (_enclosure.tight(bits) || working_bits >= _maximum_bits) {
+                                break;
+                            }
+                        } catch (const divergent_division_result_exception&) {
+                            if (working_bits >= _maximum_bits) {
+                                throw;
+                            }
+                        }
+                        working_bits = std::min(2 * working_bits, _maximum_bits);
+                    }
+                    _working_bits = working_bits;
+                    // the operands can not be refined any further
+                    _bits = working_bits >= _maximum_bits ? std::numeric_limits<size_t>::max() : bits;
+                    return _enclosure;
+                }
+            };
+        }
+
+        /**
+         * @brief A complex number whose parts are boost::real::real numbers.
+         *
+         * The additions and subtractions are done on each part. The multiplications, divisions and
+         * exponentials are fused operations instead of a tree of real operations for each part: the
+         * two parts of the result are leaves sharing the state of the operation, see
+         * boost::real::real_enclosure, which evaluate both parts at once on the rectangles of the
+         * operands, see boost::real::mul, boost::real::div and boost::real::exp on
+         * boost::real::complex_interval. A multiplication takes three real multiplications, a division
+         * computes its denominator once and an exponential sums a single exponential and a single
+         * sine and cosine series.
+         *
+         * The parts of a fused operation are refined by their own iterators, so they do not follow a
+         * later change of a boost::real::real_input operand.
+         */
+        template <typename T = int>
+        class complex {
+            real<T> _real_part;
+            real<T> _imaginary_part;
+
+            /// the fused operation on the parts of the operands
+            static complex fused(OPERATION operation, const std::vector<real<T>>& operands) {
+                auto state = std::make_shared<complex_detail::fused<T>>(operation, operands);
+                complex_interval<T> first = state->refine(2 * exact_number<T>::BITS_PER_DIGIT);
+                real_enclosure<T> real_part(first.real_part, [state] (size_t bits) {
+                    return state->refine(bits).real_part;
+                });
+                real_enclosure<T> imaginary_part(first.imaginary_part, [state] (size_t bits) {
+                    return state->refine(bits).imaginary_part;
+                });
+                return complex(real<T>(real_part), real<T>(imaginary_part));
+            }
+
+        public:
+
+            /// constructs the complex number 0
+            complex() : complex(real<T>("0")) {}
+
+            /**
+             * @brief Constructs the complex number with the given parts.
+             *
+             * @param real_part - the real part.
+             * @param imaginary_part - the imaginary part, zero by default.
+             */
+            complex(real<T> real_part, real<T> imaginary_part = real<T>("0"))
+                : _real_part(std::move(real_part)), _imaginary_part(std::move(imaginary_part)) {}
+
+            /// constructs the complex number with the parts written as in boost::real::real(std::string)
+            complex(const std::string& real_part, const std::string& imaginary_part = "0")
+                : complex(real<T>(real_part), real<T>(imaginary_part)) {}
+
+            const real<T>& real_part() const {
+                return _real_part;
+            }
+
+            const real<T>& imaginary_part() const {
+                return _imaginary_part;
+            }
+
+            complex operator+(complex other) {
+                return complex(_real_part + other._real_part, _imaginary_part + other._imaginary_part);
+            }
+
+            complex operator-(complex other) {
+                return complex(_real_part - other._real_part, _imaginary_part - other._imaginary_part);
+            }
+
+            /**
+             * @brief The fused product, whose parts are evaluated together with three real
+             * multiplications of the operands rectangles.
+             */
+            complex operator*(complex other) {
+                return fused(OPERATION::MULTIPLICATION, {_real_part, _imaginary_part, other._real_part, other._imaginary_part});
+            }
+
+            /**
+             * @brief The fused quotient, whose parts share the squared modulus of the divisor.
+             *
+             * @throws boost::real::divergent_division_result_exception if the modulus of the divisor
+             * can not be separated from zero at the maximum precision.
+             */
+            complex operator/(complex other) {
+                return fused(OPERATION::DIVISION, {_real_part, _imaginary_part, other._real_part, other._imaginary_part});
+            }
+
+            /// the complex conjugate
+            complex conj() {
+                return complex(_real_part, real<T>("0") - _imaginary_part);
+            }
+
+            /// the squared modulus, as a real number
+            real<T> norm() {
+                return _real_part * _real_part + _imaginary_part * _imaginary_part;
+            }
+
+            /// the fused exponential e^z, whose parts share the exponential of the real part
+            static complex exp(complex z) {
+                return fused(OPERATION::EXPONENT, {z._real_part, z._imaginary_part});
+            }
+
+            /// the rectangle of the parts, each of them refined to the precision in bits
+            complex_interval<T> enclosure(size_t bits) const {
+                const_precision_iterator<T> real_it = _real_part.get_real_itr();
+                real_it.refine_to_bits(bits);
+                const_precision_iterator<T> imaginary_it = _imaginary_part.get_real_itr();
+                imaginary_it.refine_to_bits(bits);
+                return complex_interval<T> {real_it.get_interval(), imaginary_it.get_interval()};
+            }
+
+            /**
+             * @brief The disk centered at the midpoint of enclosure(bits) whose radius is the sum of
+             * the half widths of its parts, which is not lower than its half diagonal.
+             */
+            complex_ball<T> ball(size_t bits) const {
+                complex_interval<T> rectangle = enclosure(bits);
+                // the halves are exact, since the base is even
+                exact_number<T> half(std::vector<T> {(std::numeric_limits<T>::max() / 4)}, 0);
+                complex_ball<T> result;
+                result.real_center = (rectangle.real_part.lower_bound + rectangle.real_part.upper_bound) * half;
+                result.real_center.normalize();
+                result.imaginary_center = (rectangle.imaginary_part.lower_bound + rectangle.imaginary_part.upper_bound) * half;
+                result.imaginary_center.normalize();
+                result.radius = (rectangle.real_part.width() + rectangle.imaginary_part.width()) * half;
+                result.radius.normalize();
+                return result;
+            }
+        };
+
+        /// the fused exponential e^z, see boost::real::complex::exp
+        template <typename T>
+        complex<T> exp(const complex<T>& z) {
+            return complex<T>::exp(z);
+        }
+    }
+}
+
+#endif // BOOST_REAL_COMPLEX_HPP
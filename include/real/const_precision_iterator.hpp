@@ -9,6 +9,7 @@
 #include <real/real_exception.hpp>
 #include <real/integer_number.hpp>
 #include <real/real_rational.hpp>
+#include <real/real_enclosure.hpp>
 #include <limits>
 #include <memory>
 #include <variant>
@@ -33,7 +34,7 @@ namespace boost {
         class real;
 
         template <typename T>
-        using real_number = std::variant<std::monostate, real_explicit<T>, real_algorithm<T>, real_operation<T>, real_rational<T>>;
+        using real_number = std::variant<std::monostate, real_explicit<T>, real_algorithm<T>, real_operation<T>, real_rational<T>, real_enclosure<T>>;
         using precision_t = size_t;
 
         /// the default max precision to use if the user hasn't provided one.
@@ -65,10 +66,63 @@ namespace boost {
                 /// current iterator precision
                 precision_t _precision;
 
+                /// current iterator precision in bits, only set by refine_to_bits on operations.
+                /// It is ignored once _precision changes, then the precision is _precision whole digits.
+                precision_t _precision_bits = 0;
+
                 /// local max precision, is used if set to > 0 by user
                 precision_t _maximum_precision = 0;
 
-                interval<T> _approximation_interval;
+                // the upper bound of explicit and algorithmic numbers is built on demand, see
+                // materialize_upper_bound, so both are mutable for the const accessors
+                mutable interval<T> _approximation_interval;
+
+                /// true when the interval of an explicit or algorithmic number is its truncation
+                /// plus one ulp of its last digit, and the bound away from zero is not built yet
+                mutable bool _upper_pending = false;
+
+                /**
+                 * @brief Builds the bound away from zero of an explicit or algorithmic number
+                 * truncated interval, which is the truncation plus one ulp of its last digit. It is
+                 * only needed when the interval is read, so iterating a leaf only extends its
+                 * truncation.
+                 */
+                void materialize_upper_bound() const {
+                    if (!_upper_pending) {
+                        return;
+                    }
+                    bool positive = _approximation_interval.lower_bound.positive;
+                    const exact_number<T>& truncation = positive ? _approximation_interval.lower_bound : _approximation_interval.upper_bound;
+                    exact_number<T>& far = positive ? _approximation_interval.upper_bound : _approximation_interval.lower_bound;
+                    build_far_bound(truncation, far);
+                    _upper_pending = false;
+                }
+
+                /// writes the truncation plus one ulp of its last digit into far
+                static void build_far_bound(const exact_number<T>& truncation, exact_number<T>& far) {
+                    T base = (std::numeric_limits<T>::max() /4)*2 - 1;
+                    far.clear();
+                    far.digits.resize(truncation.size());
+                    far.positive = truncation.positive;
+
+                    int carry = 1;
+                    for (int i = (int)truncation.size() - 1; i >= 0; --i) {
+                        if (truncation[i] + carry == base + 1) {
+                            far[i] = 0;
+                        } else {
+                            far[i] = truncation[i] + carry;
+                            carry = 0;
+                        }
+                    }
+
+                    if (carry > 0) {
+                        far.push_front(carry);
+                        far.exponent = truncation.exponent + 1;
+                    } else {
+                        far.exponent = truncation.exponent;
+                    }
+                    far.normalize_left();
+                }
 
                 void check_and_swap_boundaries() {
                     std::visit( overloaded { // perform operation on whatever is held in variant
@@ -185,6 +239,10 @@ namespace boost {
                             // _maximum_precision = std::max(real.get_lhs_itr().maximum_precision(), real.get_rhs_itr().maximum_precision());
                             },
 
+                        [this] (real_enclosure<T>& real) {
+                            this->_approximation_interval = real.get_interval();
+                        },
+
                         [this] (real_rational<T> &real){
                             if(real.b == integer_number<T>("1")){
                                 real_number<T> tmp_num = real_number<T>(real_explicit<T>(real.a));
@@ -252,6 +310,9 @@ namespace boost {
                             update_operation_boundaries(real);
                             // _maximum_precision = std::max(real.get_lhs_itr().maximum_precision(), real.get_rhs_itr().maximum_precision());
                             },
+                        [this] (real_enclosure<T>& real) {
+                            this->_approximation_interval = real.get_interval();
+                        },
                         [] (auto& real) {
                             throw boost::real::bad_variant_access_exception();
                             }
@@ -279,6 +340,13 @@ namespace boost {
                                 init_operation_itr(real, true);
                                 update_operation_boundaries(real);
                             },
+                            [this, &a] (real_enclosure<T>& real) {
+                                *this = const_precision_iterator(a);
+                                this->_precision = this->maximum_precision();
+                                if (real.refinable()) {
+                                    this->_approximation_interval = real.refine(this->precision_bits());
+                                }
+                            },
                             [] (auto & real) {
                                 throw boost::real::bad_variant_access_exception();
                             }
@@ -292,6 +360,46 @@ namespace boost {
                     return const_precision_iterator(_real_ptr);
                 }
 
+                /// returns the iterator to its first precision, keeping its maximum precision
+                void restart() {
+                    precision_t maximum_precision = _maximum_precision;
+                    *this = cbegin();
+                    _maximum_precision = maximum_precision;
+                }
+
+                /// points the iterator to the number a at its first precision, keeping its maximum precision
+                void restart(real_number<T> * a) {
+                    precision_t maximum_precision = _maximum_precision;
+                    *this = const_precision_iterator(a);
+                    _maximum_precision = maximum_precision;
+                }
+
+                /// the progress of an iterator, which can be saved and resumed, see boost::real::snapshot
+                struct iterator_state {
+                    precision_t precision = 1;
+                    precision_t precision_bits = 0;
+                    /// the maximum precision set on the iterator, zero if it uses the global one
+                    precision_t maximum_precision = 0;
+                    interval<T> approximation;
+                };
+
+                /// the current progress of the iterator
+                iterator_state state() const {
+                    return iterator_state {_precision, _precision_bits, _maximum_precision, get_interval()};
+                }
+
+                /**
+                 * @brief Sets the iterator to a saved progress of an iterator of the same number, whose
+                 * interval encloses it at that precision. The next iterations continue from there.
+                 */
+                void resume(const iterator_state& state) {
+                    _precision = state.precision;
+                    _precision_bits = state.precision_bits;
+                    _maximum_precision = state.maximum_precision;
+                    _approximation_interval = state.approximation;
+                    _upper_pending = false;
+                }
+
                 /**
                  * @brief Construct a new boost::real::const_precision_iterator that iterates the number
                  * approximation intervals in increasing order according to the approximation precision.
@@ -305,13 +413,98 @@ namespace boost {
                     return *this;
                 }
 
-                interval<T> get_interval() const {
+                /// the current approximation interval, valid until the iterator is modified
+                const interval<T>& get_interval() const {
+                    materialize_upper_bound();
                     return _approximation_interval;
                 }
 
+                /// true when the bound away from zero of a leaf interval is not built yet
+                bool upper_pending() const {
+                    return _upper_pending;
+                }
+
+                /**
+                 * @brief Returns a bound of the current interval rounded to the given bits. A pending
+                 * leaf bound is built in a temporary and not kept, so the additive kernels can read
+                 * their operands without materializing them.
+                 *
+                 * @param upper - true for the upper bound, which is rounded up, false for the lower one.
+                 */
+                exact_number<T> bound_up_to_bits(bool upper, precision_t bits) const {
+                    if (_upper_pending && upper == _approximation_interval.lower_bound.positive) {
+                        exact_number<T> far;
+                        build_far_bound(upper ? _approximation_interval.lower_bound : _approximation_interval.upper_bound, far);
+                        return far.up_to_bits(bits, upper);
+                    }
+                    return (upper ? _approximation_interval.upper_bound : _approximation_interval.lower_bound).up_to_bits(bits, upper);
+                }
+
+                /// the precision (number of digits) the iterator currently represents
+                precision_t get_precision() const {
+                    return _precision;
+                }
+
                 // fwd decl, defined in real_data.hpp
                 void operation_iterate(real_operation<T> &ro);
                 void operation_iterate_n_times(real_operation<T> &ro, int n);
+                void operation_refine_to_bits(real_operation<T> &ro, precision_t bits);
+
+                /// records the operands of an evaluated operation in the enclosure_cache, fwd decl'd
+                void touch_operands(real_operation<T> &ro);
+
+                /**
+                 * @brief Returns the precision of the current interval in bits. It is the amount of
+                 * bits held by the _precision digits, unless the iterator was refined with refine_to_bits
+                 * and has not changed its amount of digits since.
+                 */
+                precision_t precision_bits() const {
+                    if (_precision_bits != 0 && exact_number<T>::digits_for_bits(_precision_bits) == _precision) {
+                        return _precision_bits;
+                    }
+                    return _precision * exact_number<T>::BITS_PER_DIGIT;
+                }
+
+                /**
+                 * @brief Chooses the precision mode of an operation kernel from the estimated magnitude
+                 * of its result. Results within a digit of one use ABSOLUTE precision. Results further
+                 * away use RELATIVE precision, so big results do not compute useless low digits and
+                 * tiny results are not rounded to zero.
+                 *
+                 * @param magnitude_bits - estimated position of the leading bit of the result
+                 */
+                static PRECISION_MODE kernel_mode(double magnitude_bits) {
+                    if (std::abs(magnitude_bits) > exact_number<T>::BITS_PER_DIGIT) {
+                        return PRECISION_MODE::RELATIVE;
+                    }
+                    return PRECISION_MODE::ABSOLUTE;
+                }
+
+                /**
+                 * @brief It recalculates the approximation interval boundaries to the given precision
+                 * in bits. The operands are refined to the same amount of bits and the operation kernels
+                 * round to that amount of bits, so no more work than needed is done in the last digit.
+                 * Explicit and algorithmic numbers are always refined to whole digits.
+                 *
+                 * @param bits - the requested precision in bits, nothing is done if it is already reached.
+                 */
+                void refine_to_bits(precision_t bits) {
+                    if (bits <= this->precision_bits()) {
+                        return;
+                    }
+
+                    std::visit( overloaded { // perform operation on whatever is held in variant
+                        [this, &bits] (real_operation<T>& real) {
+                            operation_refine_to_bits(real, bits);
+                        },
+                        [this, &bits] (auto&) {
+                            precision_t digits = exact_number<T>::digits_for_bits(bits);
+                            if (digits > this->_precision) {
+                                this->iterate_n_times(digits - this->_precision);
+                            }
+                        }
+                    }, *_real_ptr);
+                }
 
                 /**
                  * @brief It recalculates the approximation interval boundaries increasing the used
@@ -328,6 +521,13 @@ namespace boost {
                         [this] (real_operation<T>& real) {
                             operation_iterate_n_times(real, 1);
                         },
+                        [this] (real_enclosure<T>& real) {
+                            // the interval is fixed unless the leaf can be refined, the precision grows
+                            this->_precision++;
+                            if (real.refinable()) {
+                                this->_approximation_interval = real.refine(this->precision_bits());
+                            }
+                        },
                         [] (auto& real) {
                             throw boost::real::bad_variant_access_exception();
                         }
@@ -340,7 +540,6 @@ namespace boost {
                             if (this->_precision >= real.digits().size()) {
                                 return;
                             }
-                            T base = (std::numeric_limits<T>::max() /4)*2 - 1;
                            // If the number is negative, boundaries are interpreted as mirrored:
                            // First, the operation is made as positive, and after boundary calculation
                            // boundaries are swapped to come back to the negative representation.
@@ -353,6 +552,7 @@ namespace boost {
                                    this->_approximation_interval.lower_bound.push_back(real.digits()[i]);
                                }
                                this->_approximation_interval.upper_bound = this->_approximation_interval.lower_bound;
+                               this->_upper_pending = false;
 
                            } else {
 
@@ -363,30 +563,16 @@ namespace boost {
                                    this->_approximation_interval.lower_bound.push_back(real.digits()[i]);
                                }
 
-                               this->_approximation_interval.upper_bound.clear();
-                               this->_approximation_interval.upper_bound.digits.resize(this->_approximation_interval.lower_bound.size());
-
-                               int carry = 1;
-                               for (int i = (int)this->_approximation_interval.lower_bound.size() - 1; i >= 0; --i) {
-                                   if (this->_approximation_interval.lower_bound[i] + carry == base + 1) {
-                                       this->_approximation_interval.upper_bound[i] = 0;
-                                   } else {
-                                       this->_approximation_interval.upper_bound[i] = this->_approximation_interval.lower_bound[i] + carry;
-                                       carry = 0;
-                                   }
-                               }
-
-                               if (carry > 0) {
-                                   this->_approximation_interval.upper_bound.push_front(carry);
-                                   this->_approximation_interval.upper_bound.exponent = this->_approximation_interval.lower_bound.exponent + 1;
-                               } else {
-                                   this->_approximation_interval.upper_bound.exponent = this->_approximation_interval.lower_bound.exponent;
-                               }
+                               this->_approximation_interval.upper_bound.digits.clear();
+                               this->_upper_pending = true;
                            }
 
-                           // Left normalization of boundaries representation
+                           // Left normalization of boundaries representation, the upper bound
+                           // is normalized when it is built
                            this->_approximation_interval.lower_bound.normalize_left();
-                           this->_approximation_interval.upper_bound.normalize_left();
+                           if (!this->_upper_pending) {
+                               this->_approximation_interval.upper_bound.normalize_left();
+                           }
 
                            this->check_and_swap_boundaries();
                            this->_precision = std::min(this->_precision + n, real.digits().size());
@@ -395,35 +581,18 @@ namespace boost {
                            // If the number is negative, bounds are interpreted as mirrored:
                            // First, the operation is made as positive, and after bound calculation
                            // bounds are swapped to come back to the negative representation.
-                           T base = (std::numeric_limits<T>::max() /4)*2 - 1;
                            this->check_and_swap_boundaries();
 
                            for (int i = 0; i < n; i++) {
                                this->_approximation_interval.lower_bound.push_back((real)[this->_precision + i]);
                            }
 
-                           this->_approximation_interval.upper_bound.clear();
-                           this->_approximation_interval.upper_bound.digits.resize(this->_approximation_interval.lower_bound.size());
-                           int carry = 1;
-                           for (int i = (int)this->_approximation_interval.lower_bound.size() - 1; i >= 0; --i) {
-                               if (this->_approximation_interval.lower_bound[i] + carry == base + 1) {
-                                   this->_approximation_interval.upper_bound[i] = 0;
-                               } else {
-                                   this->_approximation_interval.upper_bound[i] = this->_approximation_interval.lower_bound[i] + carry;
-                                   carry = 0;
-                               }
-                           }
+                           this->_approximation_interval.upper_bound.digits.clear();
+                           this->_upper_pending = true;
 
-                           if (carry > 0) {
-                               this->_approximation_interval.upper_bound.push_front(carry);
-                               this->_approximation_interval.upper_bound.exponent = this->_approximation_interval.lower_bound.exponent + 1;
-                           } else {
-                               this->_approximation_interval.upper_bound.exponent = this->_approximation_interval.lower_bound.exponent;
-                           }
-
-                           // Left normalization of boundaries representation
+                           // Left normalization of the truncation, the upper bound is normalized
+                           // when it is built
                            this->_approximation_interval.lower_bound.normalize_left();
-                           this->_approximation_interval.upper_bound.normalize_left();
 
                            this->check_and_swap_boundaries();
                            this->_precision += n;
@@ -431,6 +600,12 @@ namespace boost {
                         [this, &n] (real_operation<T>& real) {
                             operation_iterate_n_times(real, n);
                         },
+                        [this, &n] (real_enclosure<T>& real) {
+                            this->_precision += n;
+                            if (real.refinable()) {
+                                this->_approximation_interval = real.refine(this->precision_bits());
+                            }
+                        },
                         [] (auto & real) {
                             throw boost::real::bad_variant_access_exception();
                         }
@@ -450,7 +625,7 @@ namespace boost {
                         return false;
                     }
 
-                    return (other._real_ptr == this->_real_ptr) && (other._approximation_interval == this->_approximation_interval);
+                    return (other._real_ptr == this->_real_ptr) && (other.get_interval() == this->get_interval());
                 }
 
                 /**
@@ -0,0 +1,315 @@
+#ifndef BOOST_REAL_DOUBLE_DOUBLE_INTERVAL_HPP
+#define BOOST_REAL_DOUBLE_DOUBLE_INTERVAL_HPP
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+
+#include <real/exact_number.hpp>
+#include <real/double_interval.hpp>
+
+namespace boost {
+    namespace real {
+
+        /// an unevaluated sum hi + lo of two doubles, with |lo| at most half an ulp of hi
+        struct double_double {
+            double hi = 0;
+            double lo = 0;
+        };
+
+        namespace double_double_detail {
+            constexpr double infinity = std::numeric_limits<double>::infinity();
+
+            // error free transformations: the results hold the exact sum or product
+            inline double_double two_sum(double a, double b) {
+                double s = a + b;
+                double bb = s - a;
+                return {s, (a - (s - bb)) + (b - bb)};
+            }
+
+            inline double_double quick_two_sum(double a, double b) {
+                double s = a + b;
+                return {s, b - (s - a)};
+            }
+
+            inline double_double two_prod(double a, double b) {
+                double p = a * b;
+                return {p, std::fma(a, b, -p)};
+            }
+
+            // the arithmetic below has a relative error of a few 2^-106, see Joldes, Muller and Popescu,
+            // "Tight and rigorous error bounds for basic building blocks of double-word arithmetic"
+            inline double_double add(const double_double& a, const double_double& b) {
+                double_double s = two_sum(a.hi, b.hi);
+                double_double t = two_sum(a.lo, b.lo);
+                s = quick_two_sum(s.hi, s.lo + t.hi);
+                return quick_two_sum(s.hi, s.lo + t.lo);
+            }
+
+            inline double_double negate(const double_double& a) {
+                return {-a.hi, -a.lo};
+            }
+
+            inline double_double mul(const double_double& a, const double_double& b) {
+                double_double p = two_prod(a.hi, b.hi);
+                return quick_two_sum(p.hi, p.lo + (a.hi * b.lo + a.lo * b.hi));
+            }
+
+            inline double_double div(const double_double& a, const double_double& b) {
+                double q1 = a.hi / b.hi;
+                double_double r = add(a, negate(mul(b, {q1, 0})));
+                double q2 = r.hi / b.hi;
+                r = add(r, negate(mul(b, {q2, 0})));
+                double q3 = r.hi / b.hi;
+                return add(quick_two_sum(q1, q2), {q3, 0});
+            }
+
+            /**
+             * @brief Moves x down (or up) by more than the error of the arithmetic above, so a
+             * rounded result becomes a rigorous bound. Values close to the underflow threshold
+             * lose their lower word, so they are moved by an absolute amount as well.
+             */
+            inline double_double widen(const double_double& x, bool upper) {
+                double margin = std::ldexp(std::abs(x.hi), -96) + std::ldexp(1.0, -1060);
+                double lo = upper ? std::nextafter(x.lo + margin, infinity) : std::nextafter(x.lo - margin, -infinity);
+                return quick_two_sum(x.hi, lo);
+            }
+
+            /// true if a < b for sure, false if a >= b or if they are too close to decide
+            inline bool certainly_less(const double_double& a, const double_double& b) {
+                double_double s = two_sum(b.hi, -a.hi); // b.hi - a.hi, exactly
+                double rest = s.lo + (b.lo - a.lo);
+                double bound = std::ldexp(std::abs(s.lo) + std::abs(b.lo) + std::abs(a.lo), -50);
+                if (s.hi > 0) {
+                    return std::abs(rest) + 2 * bound < s.hi;
+                }
+                return s.hi == 0 && rest > 2 * bound;
+            }
+
+            /// approximate order, only used to choose between candidate bounds which are widened anyway
+            inline bool approximately_less(const double_double& a, const double_double& b) {
+                return a.hi < b.hi || (a.hi == b.hi && a.lo < b.lo);
+            }
+
+            /// the digit x as a double-double, exactly: digits of 64 bits integers do not fit in a double
+            template <typename T>
+            double_double from_digit(T x) {
+                double hi = (double) x;
+                T rounded = (T) hi;
+                // the rounding may be upward, and x - rounded would wrap around for unsigned types
+                return {hi, rounded <= x ? (double) (x - rounded) : -(double) (rounded - x)};
+            }
+
+            inline bool is_finite(const double_double& a) {
+                return std::isfinite(a.hi) && std::isfinite(a.lo);
+            }
+        }
+
+        /**
+         * @brief An interval of double-double numbers which encloses a number with about 100 bits
+         * of precision. It is the tier between double_interval and the exact_number limbs: the
+         * basic operations are computed with error free transformations and their results are
+         * widened by more than their error, so the enclosure stays rigorous without changing the
+         * rounding mode of the processor. As for double_interval, the default interval is the
+         * entire real line, which is the enclosure of anything this tier can not handle.
+         */
+        struct double_double_interval {
+            double_double lower {-std::numeric_limits<double>::infinity(), 0};
+            double_double upper {std::numeric_limits<double>::infinity(), 0};
+
+            double_double_interval() = default;
+
+            double_double_interval(const double_double& lower, const double_double& upper) : lower(lower), upper(upper) {
+                if (!double_double_detail::is_finite(lower) || !double_double_detail::is_finite(upper)) {
+                    *this = double_double_interval();
+                }
+            }
+
+            /// the double interval as a double-double interval, the bounds are exact
+            explicit double_double_interval(const double_interval& x) : lower{x.lower, 0}, upper{x.upper, 0} {}
+
+            bool is_entire() const {
+                return std::isinf(lower.hi) && std::isinf(upper.hi);
+            }
+
+            bool positive() const {
+                return lower.hi > 0;
+            }
+
+            bool negative() const {
+                return upper.hi < 0;
+            }
+
+            /// true if every number in this interval is lower than every number in other
+            bool operator<(const double_double_interval& other) const {
+                return !is_entire() && !other.is_entire() && double_double_detail::certainly_less(upper, other.lower);
+            }
+
+            /// true if every number in this interval is greater than every number in other
+            bool operator>(const double_double_interval& other) const {
+                return other < *this;
+            }
+        };
+
+        inline double_double_interval operator+(const double_double_interval& a, const double_double_interval& b) {
+            using namespace double_double_detail;
+            if (a.is_entire() || b.is_entire()) {
+                return {};
+            }
+            return {widen(add(a.lower, b.lower), false), widen(add(a.upper, b.upper), true)};
+        }
+
+        inline double_double_interval operator-(const double_double_interval& a, const double_double_interval& b) {
+            using namespace double_double_detail;
+            if (a.is_entire() || b.is_entire()) {
+                return {};
+            }
+            return {widen(add(a.lower, negate(b.upper)), false), widen(add(a.upper, negate(b.lower)), true)};
+        }
+
+        inline double_double_interval operator*(const double_double_interval& a, const double_double_interval& b) {
+            using namespace double_double_detail;
+            if (a.is_entire() || b.is_entire()) {
+                return {};
+            }
+            double_double products[] = {mul(a.lower, b.lower), mul(a.lower, b.upper), mul(a.upper, b.lower), mul(a.upper, b.upper)};
+            double_double lower = widen(products[0], false);
+            double_double upper = widen(products[0], true);
+            for (const double_double& p : products) {
+                double_double p_lower = widen(p, false);
+                double_double p_upper = widen(p, true);
+                if (approximately_less(p_lower, lower)) {
+                    lower = p_lower;
+                }
+                if (approximately_less(upper, p_upper)) {
+                    upper = p_upper;
+                }
+            }
+            return {lower, upper};
+        }
+
+        inline double_double_interval operator/(const double_double_interval& a, const double_double_interval& b) {
+            using namespace double_double_detail;
+            if (!b.positive() && !b.negative()) {
+                return {};
+            }
+            double_double_interval inverse {widen(div({1, 0}, b.upper), false), widen(div({1, 0}, b.lower), true)};
+            return a * inverse;
+        }
+
+        /// encloses x^n for a natural n, by binary exponentiation
+        inline double_double_interval pow(double_double_interval x, unsigned long n) {
+            double_double_interval result {{1, 0}, {1, 0}};
+            while (n > 0) {
+                if (n % 2 == 1) {
+                    result = result * x;
+                }
+                n /= 2;
+                if (n > 0) {
+                    x = x * x;
+                }
+            }
+            return result;
+        }
+
+        /**
+         * @brief Encloses the number 0.d1d2... * base^exponent, from its five leading digits, which
+         * hold more bits than a double-double. Exponents out of the double range give the enclosure
+         * of double_interval.
+         */
+        template <typename T>
+        double_double_interval enclose_double_double(const std::vector<T>& digits, int exponent, bool positive) {
+            using namespace double_double_detail;
+            const double_double base = from_digit((std::numeric_limits<T>::max() / 4) * 2);
+            size_t first = 0;
+            while (first < digits.size() && digits[first] == 0) {
+                ++first;
+            }
+            if (first == digits.size()) {
+                return {{0, 0}, {0, 0}};
+            }
+            exponent -= (int) first;
+
+            size_t last = std::min(digits.size(), first + 5);
+            int scale = exponent - (int) (last - first);
+            if (scale > 30 || scale < -30) {
+                return double_double_interval(enclose(digits, exponent + (int) first, positive));
+            }
+
+            double_double lower, upper;
+            for (size_t i = first; i < last; ++i) {
+                lower = widen(add(widen(mul(lower, base), false), from_digit(digits[i])), false);
+                upper = widen(add(widen(mul(upper, base), true), from_digit(digits[i])), true);
+            }
+            if (last < digits.size()) {
+                upper = widen(add(upper, {1, 0}), true);
+            }
+            for (; scale > 0; --scale) {
+                lower = widen(mul(lower, base), false);
+                upper = widen(mul(upper, base), true);
+            }
+            for (; scale < 0; ++scale) {
+                lower = widen(div(lower, base), false);
+                upper = widen(div(upper, base), true);
+            }
+
+            if (positive) {
+                return {lower, upper};
+            }
+            return {negate(upper), negate(lower)};
+        }
+
+        template <typename T>
+        double_double_interval enclose_double_double(const exact_number<T>& x) {
+            return enclose_double_double(x.digits, x.exponent, x.positive);
+        }
+
+        /**
+         * @brief Converts a finite double into the exact_number with the same value. A double is
+         * m * 2^k with an integer m, and as the base is even, 1/2 is the single digit base/2, so
+         * the conversion is exact: it takes one digit per halving.
+         */
+        template <typename T>
+        exact_number<T> to_exact_number(double x) {
+            const std::uint64_t base = (std::uint64_t) ((std::numeric_limits<T>::max() / 4) * 2);
+            if (x == 0) {
+                return exact_number<T>();
+            }
+            int k;
+            double fraction = std::frexp(std::abs(x), &k);
+            std::uint64_t m = (std::uint64_t) std::ldexp(fraction, 53);
+            k -= 53;
+            while (m % 2 == 0) {
+                m /= 2;
+                ++k;
+            }
+
+            std::vector<T> digits;
+            while (m > 0) {
+                digits.insert(digits.begin(), (T) (m % base));
+                m /= base;
+            }
+            exact_number<T> result(digits, (int) digits.size());
+
+            exact_number<T> factor(std::vector<T> {k > 0 ? (T) 2 : (T) (base / 2)}, k > 0 ? 1 : 0);
+            for (int i = 0; i < std::abs(k); ++i) {
+                result = result * factor;
+            }
+            result.normalize();
+            result.positive = x > 0;
+            return result;
+        }
+
+        template <typename T>
+        exact_number<T> to_exact_number(const double_double& x) {
+            exact_number<T> result = to_exact_number<T>(x.hi);
+            exact_number<T> lo = to_exact_number<T>(x.lo);
+            result += lo;
+            return result;
+        }
+    }
+}
+
+#endif // BOOST_REAL_DOUBLE_DOUBLE_INTERVAL_HPP
@@ -0,0 +1,221 @@
+#ifndef BOOST_REAL_DOUBLE_INTERVAL_HPP
+#define BOOST_REAL_DOUBLE_INTERVAL_HPP
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <algorithm>
+
+#include <real/exact_number.hpp>
+
+namespace boost {
+    namespace real {
+
+        /**
+         * @brief An interval of doubles which encloses a number, used as a cheap filter before the
+         * exact engine. Every operation rounds its result outwards by one ulp on each side with
+         * std::nextafter, which covers the rounding error of the basic operations. The results of
+         * exp, log, sin and cos are widened by two ulps, as the math library keeps them within one ulp.
+         *
+         * The default interval is the entire real line, which is the enclosure of anything the
+         * filter can not handle: operations on it always give the entire line again, so the exact
+         * engine takes over.
+         */
+        struct double_interval {
+            double lower = -std::numeric_limits<double>::infinity();
+            double upper = std::numeric_limits<double>::infinity();
+
+            bool is_entire() const {
+                return std::isinf(lower) && lower < 0 && std::isinf(upper) && upper > 0;
+            }
+
+            bool positive() const {
+                return lower > 0;
+            }
+
+            bool negative() const {
+                return upper < 0;
+            }
+
+            /// true if every number in this interval is lower than every number in other
+            bool operator<(const double_interval& other) const {
+                return upper < other.lower;
+            }
+
+            /// true if every number in this interval is greater than every number in other
+            bool operator>(const double_interval& other) const {
+                return other.upper < lower;
+            }
+        };
+
+        namespace double_interval_detail {
+            constexpr double infinity = std::numeric_limits<double>::infinity();
+            constexpr double pi = 3.141592653589793;
+
+            inline double down(double x) {
+                return std::nextafter(x, -infinity);
+            }
+
+            inline double up(double x) {
+                return std::nextafter(x, infinity);
+            }
+
+            /**
+             * @brief Encloses sin (offset = pi/2) or cos (offset = 0) over x. The extrema are at
+             * offset + k * pi, with value 1 for even k. As they are located in double precision, an
+             * extremum close to a boundary is taken as inside the interval.
+             */
+            inline double_interval periodic(const double_interval& x, double (*f)(double), double offset) {
+                if (!(std::abs(x.lower) < 1e8 && std::abs(x.upper) < 1e8) || x.upper - x.lower > 2 * pi) {
+                    return {-1, 1};
+                }
+                double a = f(x.lower);
+                double b = f(x.upper);
+                double_interval result {down(down(std::min(a, b))), up(up(std::max(a, b)))};
+
+                double first = std::floor((x.lower - offset) / pi) - 1;
+                double last = std::ceil((x.upper - offset) / pi) + 1;
+                for (double k = first; k <= last; ++k) {
+                    double extremum = offset + k * pi;
+                    double margin = 1e-9 * (1 + std::abs(extremum));
+                    if (extremum >= x.lower - margin && extremum <= x.upper + margin) {
+                        if (std::fmod(std::abs(k), 2) == 0) {
+                            result.upper = 1;
+                        } else {
+                            result.lower = -1;
+                        }
+                    }
+                }
+                result.lower = std::max(result.lower, -1.0);
+                result.upper = std::min(result.upper, 1.0);
+                return result;
+            }
+        }
+
+        inline double_interval operator+(const double_interval& a, const double_interval& b) {
+            using namespace double_interval_detail;
+            return {down(a.lower + b.lower), up(a.upper + b.upper)};
+        }
+
+        inline double_interval operator-(const double_interval& a, const double_interval& b) {
+            using namespace double_interval_detail;
+            return {down(a.lower - b.upper), up(a.upper - b.lower)};
+        }
+
+        inline double_interval operator*(const double_interval& a, const double_interval& b) {
+            using namespace double_interval_detail;
+            if (a.is_entire() || b.is_entire()) {
+                return {};
+            }
+            double products[] = {a.lower * b.lower, a.lower * b.upper, a.upper * b.lower, a.upper * b.upper};
+            for (double p : products) {
+                if (std::isnan(p)) { // 0 * inf
+                    return {};
+                }
+            }
+            return {down(*std::min_element(products, products + 4)), up(*std::max_element(products, products + 4))};
+        }
+
+        inline double_interval operator/(const double_interval& a, const double_interval& b) {
+            using namespace double_interval_detail;
+            if (!b.positive() && !b.negative()) {
+                return {};
+            }
+            double_interval inverse {down(1 / b.upper), up(1 / b.lower)};
+            return a * inverse;
+        }
+
+        inline double_interval exp(const double_interval& x) {
+            using namespace double_interval_detail;
+            return {std::max(down(down(std::exp(x.lower))), 0.0), up(up(std::exp(x.upper)))};
+        }
+
+        inline double_interval log(const double_interval& x) {
+            using namespace double_interval_detail;
+            if (!x.positive()) { // the exact engine decides if the number is out of the domain
+                return {};
+            }
+            return {down(down(std::log(x.lower))), up(up(std::log(x.upper)))};
+        }
+
+        inline double_interval sin(const double_interval& x) {
+            return double_interval_detail::periodic(x, [] (double y) { return std::sin(y); }, double_interval_detail::pi / 2);
+        }
+
+        inline double_interval cos(const double_interval& x) {
+            return double_interval_detail::periodic(x, [] (double y) { return std::cos(y); }, 0);
+        }
+
+        /// encloses x^n for a natural n, by binary exponentiation
+        inline double_interval pow(double_interval x, unsigned long n) {
+            double_interval result {1, 1};
+            while (n > 0) {
+                if (n % 2 == 1) {
+                    result = result * x;
+                }
+                n /= 2;
+                if (n > 0) {
+                    x = x * x;
+                }
+            }
+            return result;
+        }
+
+        /**
+         * @brief Encloses the number 0.d1d2... * base^exponent. The three leading digits are
+         * accumulated with directed rounding and the remaining digits add at most one unit of the
+         * third one. Exponents out of the double range saturate the bounds to the largest double and
+         * infinity, or to zero and the smallest subnormal.
+         */
+        template <typename T>
+        double_interval enclose(const std::vector<T>& digits, int exponent, bool positive) {
+            using namespace double_interval_detail;
+            const double base = (double) ((std::numeric_limits<T>::max() / 4) * 2);
+            size_t first = 0;
+            while (first < digits.size() && digits[first] == 0) {
+                ++first;
+            }
+            if (first == digits.size()) {
+                return {0, 0};
+            }
+            exponent -= (int) first;
+
+            double lower = 0, upper = 0;
+            size_t last = std::min(digits.size(), first + 3);
+            for (size_t i = first; i < last; ++i) {
+                lower = down(down(lower * base) + (double) digits[i]);
+                upper = up(up(upper * base) + (double) digits[i]);
+            }
+            if (last < digits.size()) {
+                upper = up(upper + 1);
+            }
+
+            // the value is (lower or upper) * base^(exponent - kept digits), the scaling stops
+            // once the bounds saturate to [max, inf] or [0, smallest subnormal]
+            int scale = exponent - (int) (last - first);
+            for (; scale > 0 && lower < std::numeric_limits<double>::max(); --scale) {
+                lower = down(lower * base);
+                upper = up(upper * base);
+            }
+            if (scale > 0) {
+                upper = infinity;
+            }
+            for (; scale < 0 && (lower > 0 || upper > std::numeric_limits<double>::denorm_min()); ++scale) {
+                lower = std::max(down(lower / base), 0.0);
+                upper = up(upper / base);
+            }
+
+            if (positive) {
+                return {lower, upper};
+            }
+            return {-upper, -lower};
+        }
+
+        template <typename T>
+        double_interval enclose(const exact_number<T>& x) {
+            return enclose(x.digits, x.exponent, x.positive);
+        }
+    }
+}
+
+#endif // BOOST_REAL_DOUBLE_INTERVAL_HPP
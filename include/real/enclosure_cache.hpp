@@ -0,0 +1,143 @@
+#ifndef BOOST_REAL_ENCLOSURE_CACHE_HPP
+#define BOOST_REAL_ENCLOSURE_CACHE_HPP
+
+#include <cstddef>
+#include <list>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+
+namespace boost {
+    namespace real {
+
+        // fwd decl
+        template <typename T>
+        class real_data;
+
+        template <typename T>
+        class real_operation;
+
+        /**
+         * @brief A memory budget for the approximation intervals kept by the operands of the
+         * boost::real::real numbers operation trees.
+         *
+         * Every node keeps the interval of the highest precision it was evaluated to, which after
+         * a deep evaluation holds many digits that are not read again. With a capacity set, the
+         * operands used by an evaluation are recorded in least recently used order together with
+         * the size of their intervals, and once the outermost evaluation is done, the least
+         * recently used ones are restarted at their first precision until the recorded size fits
+         * the capacity. Their parents keep their own intervals, and when a parent needs more
+         * precision its operands are evaluated again from there.
+         *
+         * Only operations which are operands of other operations are evicted, the numbers held
+         * by the user keep their intervals unless they are used as operands too. A capacity of
+         * zero, the default, disables the cache. It is not thread safe.
+         */
+        template <typename T = int>
+        class enclosure_cache {
+            struct state {
+                size_t capacity = 0;
+                size_t size = 0;
+                // evaluations in progress, evictions wait until there is none
+                size_t evaluations = 0;
+                // most recently used first
+                std::list<real_data<T>*> order;
+                std::unordered_map<real_data<T>*, std::pair<typename std::list<real_data<T>*>::iterator, size_t>> entries;
+            };
+
+            // never destroyed, so the nodes destroyed at exit can still forget themselves
+            static state& get() {
+                static state* instance = new state();
+                return *instance;
+            }
+
+            static void evict() {
+                state& s = get();
+                while (s.size > s.capacity && !s.order.empty()) {
+                    real_data<T>* victim = s.order.back();
+                    s.size -= s.entries[victim].second;
+                    s.entries.erase(victim);
+                    s.order.pop_back();
+                    victim->evict_enclosure();
+                }
+            }
+
+        public:
+
+            /**
+             * @brief Marks the scope of an evaluation. Evictions are done when the outermost
+             * evaluation ends, so the intervals of an evaluation in progress are never reset.
+             */
+            struct evaluation {
+                evaluation() {
+                    get().evaluations++;
+                }
+
+                ~evaluation() {
+                    state& s = get();
+                    if (--s.evaluations == 0 && s.capacity != 0 && s.size > s.capacity) {
+                        evict();
+                    }
+                }
+
+                evaluation(const evaluation&) = delete;
+                evaluation& operator=(const evaluation&) = delete;
+            };
+
+            /// sets the budget in bytes of the recorded intervals, zero disables the cache
+            static void set_capacity(size_t bytes) {
+                state& s = get();
+                s.capacity = bytes;
+                if (bytes == 0) {
+                    s.order.clear();
+                    s.entries.clear();
+                    s.size = 0;
+                } else if (s.evaluations == 0) {
+                    evict();
+                }
+            }
+
+            static size_t capacity() {
+                return get().capacity;
+            }
+
+            /// the size in bytes of the recorded intervals
+            static size_t size() {
+                return get().size;
+            }
+
+            /// records that the operand node was used by an evaluation, if it is an operation
+            static void touch(real_data<T>* node) {
+                state& s = get();
+                if (s.capacity == 0 || !std::holds_alternative<real_operation<T>>(node->get_real_number())) {
+                    return;
+                }
+                size_t bytes = node->enclosure_bytes();
+                auto it = s.entries.find(node);
+                if (it != s.entries.end()) {
+                    s.size -= it->second.second;
+                    s.order.erase(it->second.first);
+                }
+                s.order.push_front(node);
+                s.entries[node] = {s.order.begin(), bytes};
+                s.size += bytes;
+            }
+
+            /// removes a destroyed node
+            static void forget(real_data<T>* node) {
+                state& s = get();
+                if (s.entries.empty()) {
+                    return;
+                }
+                auto it = s.entries.find(node);
+                if (it != s.entries.end()) {
+                    s.size -= it->second.second;
+                    s.order.erase(it->second.first);
+                    s.entries.erase(it);
+                }
+            }
+        };
+    }
+}
+
+#endif // BOOST_REAL_ENCLOSURE_CACHE_HPP
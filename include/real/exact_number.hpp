@@ -6,6 +6,7 @@
 #include <sstream>
 #include <algorithm>
 #include <math.h>
+#include <cmath>
 #include <type_traits>
 #include <limits>
 #include <iterator>
@@ -14,6 +15,15 @@
 namespace boost {
     namespace real {
 
+        /**
+         * @brief Selects how the precision given to a kernel bounds its error.
+         *
+         * ABSOLUTE: the error is bounded by 2^-bits.
+         * RELATIVE: the error is bounded by 2^-bits times the magnitude of the result, i.e. bits
+         * counts the significant bits from the leading nonzero digit.
+         */
+        enum class PRECISION_MODE{ABSOLUTE, RELATIVE};
+
         template <typename T = int>
         struct exact_number {
             using exponent_t = int;
@@ -21,6 +31,9 @@ namespace boost {
             // TODO: replace all redundant declarations of base with this
             // static const T BASE = ;
 
+            /// amount of bits a digit can hold. The base is slightly lower than 2^BITS_PER_DIGIT.
+            static constexpr size_t BITS_PER_DIGIT = std::numeric_limits<T>::digits - 1;
+
             std::vector<T> digits = {};
             exponent_t exponent = 0;
             bool positive = true;
@@ -49,7 +62,7 @@ namespace boost {
             }
 
             /// adds other to *this. disregards sign -- that's taken care of in the operators.
-            void add_vector(exact_number &other, T base = (std::numeric_limits<T>::max() /4)*2 - 1){
+            void add_vector(const exact_number &other, T base = (std::numeric_limits<T>::max() /4)*2 - 1){
                 int carry = 0;
                 std::vector<T> temp;
                 int fractional_length = std::max((int)this->digits.size() - this->exponent, (int)other.digits.size() - other.exponent);
@@ -105,7 +118,7 @@ namespace boost {
             }
 
             /// subtracts other from *this, disregards sign -- that's taken care of in the operators
-            void subtract_vector(exact_number &other, T base = (std::numeric_limits<T>::max() /4)*2 - 1) {
+            void subtract_vector(const exact_number &other, T base = (std::numeric_limits<T>::max() /4)*2 - 1) {
                 std::vector<T> result;
                 int fractional_length = std::max((int)this->digits.size() - this->exponent, (int)other.digits.size() - other.exponent);
                 int integral_length = std::max(this->exponent, other.exponent);
@@ -193,7 +206,7 @@ namespace boost {
             } 
 
             /// multiplies *this by other
-            void multiply_vector(exact_number &other, T base = (std::numeric_limits<T>::max() /4)*2) {
+            void multiply_vector(const exact_number &other, T base = (std::numeric_limits<T>::max() /4)*2) {
                 // will keep the result number in vector in reverse order
                 // Digits: .123 | Exponent: -3 | .000123 <--- Number size is the Digits size less the exponent
                 // Digits: .123 | Exponent: 2  | 12.3
@@ -720,6 +733,29 @@ namespace boost {
 
             }
 
+            /*              DIVISION WITH BIT PRECISION
+             *  @brief:  divides (*this) by divisor
+             *  @param:  divisor: number which divides (*this)
+             *  @param:  max_error_bits: precision of the result in bits. The quotient is computed in
+             *           whole digits, so the error is at most the one of digits_for_bits(max_error_bits) digits.
+             *  @param:  upper: if true: error lies in [0, +epsilon]
+             *                  else: error lies in [-epsilon, 0]
+             *  @param:  mode: RELATIVE bounds the error relative to the quotient magnitude. This is what
+             *           newton_raphson_division does, as it divides the operands scaled to the same exponent.
+             *           ABSOLUTE bounds the error by 2^(-max_error_bits), adding or removing as many digits
+             *           as the quotient has before the digits point.
+             */
+            void divide_vector_bits(const exact_number<T> divisor, size_t max_error_bits, bool upper, PRECISION_MODE mode = PRECISION_MODE::RELATIVE) {
+                int digits_amount = (int) digits_for_bits(max_error_bits);
+
+                if (mode == PRECISION_MODE::ABSOLUTE) {
+                    digits_amount = std::max(digits_amount + this->exponent - divisor.exponent, 1);
+                }
+
+                newton_raphson_division(divisor, digits_amount, upper);
+
+            }
+
             /*          BINARY SEARCH BASED DIVISION
              *      an approximate division method, used in the initial guess of reciprocal in Newton Raphson
              */
@@ -1420,7 +1456,7 @@ namespace boost {
                 return result;
             }
 
-            exact_number<T> operator+(exact_number<T> other) {
+            exact_number<T> operator+(exact_number<T> other) const {
                 exact_number<T> result;
 
                 if (this->positive == other.positive) {
@@ -1462,7 +1498,7 @@ namespace boost {
                 return result;
             }
 
-            exact_number<T> operator-(exact_number<T> other) {
+            exact_number<T> operator-(exact_number<T> other) const {
                 exact_number<T> result;
 
                 if (this->positive != other.positive) {
@@ -1511,7 +1547,7 @@ namespace boost {
                 return result;
             }
 
-            exact_number<T> operator*(exact_number<T> other) {
+            exact_number<T> operator*(exact_number<T> other) const {
                 exact_number<T> result = *this;
                 result.multiply_vector(other);
                 result.positive = (this->positive == other.positive);
@@ -1794,17 +1830,21 @@ namespace boost {
                 return this->digits[n];
             }
 
+            const T &operator[](int n) const {
+                return this->digits[n];
+            }
+
             /**
              * @brief It returns the number of digits of the boost::real::exact_number
              *
              * @return an unsigned long representing the number of digits of the boost::real::exact_number
              */
-            unsigned long size() {
+            unsigned long size() const {
                 return this->digits.size();
             }
 
             /// returns an exact_number that has the precision given
-            exact_number<T> up_to(size_t precision, bool upper) {
+            exact_number<T> up_to(size_t precision, bool upper) const {
                 T base = (std::numeric_limits<T>::max() /4)*2 - 1;
                 if (precision >= digits.size())
                     return *this;
@@ -1824,6 +1864,99 @@ namespace boost {
                 return ret;
             }
 
+            /**
+             * @brief Returns an exact_number that has the precision given in bits. The first
+             * bits / BITS_PER_DIGIT digits are kept, and the next one is rounded to a multiple of
+             * 2^(BITS_PER_DIGIT - bits % BITS_PER_DIGIT). When bits is a multiple of BITS_PER_DIGIT
+             * the result is the same as up_to(bits / BITS_PER_DIGIT, upper).
+             *
+             * @param bits - the amount of significant bits to keep
+             * @param upper - if true the result is rounded up, else it is rounded down
+             */
+            exact_number<T> up_to_bits(size_t bits, bool upper) const {
+                size_t full_digits = bits / BITS_PER_DIGIT;
+                size_t remaining_bits = bits % BITS_PER_DIGIT;
+
+                if (remaining_bits == 0)
+                    return up_to(std::max(full_digits, (size_t) 1), upper);
+
+                if (full_digits >= digits.size())
+                    return *this;
+
+                exact_number<T> ret = *this;
+                bool inexact = digits.size() > full_digits + 1;
+                ret.digits.resize(full_digits + 1);
+
+                T granularity = (T) 1 << (BITS_PER_DIGIT - remaining_bits);
+                T dropped = ret.digits.back() % granularity;
+                ret.digits.back() -= dropped;
+                inexact = inexact || (dropped != 0);
+
+                // truncation rounds towards zero, so only rounding away from zero needs a correction
+                if (inexact && upper == positive) {
+                    exact_number<T> ulp(std::vector<T> {granularity}, exponent - (int) full_digits, positive);
+                    ret = ret + ulp;
+                }
+
+                return ret;
+            }
+
+            /**
+             * @brief Returns the absolute error bound used by the kernels for a precision in bits.
+             * As the digit-granular kernels did with the exact_number {1} of exponent -p, which is
+             * 1*base^-(p+1), the bound keeps one guard digit: it is about 2^-(bits + BITS_PER_DIGIT).
+             * When bits is a multiple of BITS_PER_DIGIT it is exactly the digit-granular bound.
+             *
+             * @param bits - the amount of bits of absolute precision
+             */
+            static exact_number<T> error_bound(size_t bits) {
+                size_t full_digits = bits / BITS_PER_DIGIT;
+                size_t remaining_bits = bits % BITS_PER_DIGIT;
+
+                if (remaining_bits == 0)
+                    return exact_number<T>(std::vector<T> {1}, -(int) full_digits, true);
+
+                return exact_number<T>(std::vector<T> {(T) 1 << (BITS_PER_DIGIT - remaining_bits)}, -(int) full_digits - 1, true);
+            }
+
+            /**
+             * @brief Position of the leading bit of the number, relative to the digits point: the
+             * absolute value of the number is about 2^(leading_bit - 1) to 2^leading_bit.
+             *
+             * @return the leading bit position, or the lowest int for zero.
+             */
+            int leading_bit() const {
+                for (size_t i = 0; i < digits.size(); ++i) {
+                    if (digits[i] != 0) {
+                        int length = 0;
+                        for (T digit = digits[i]; digit > 0; digit >>= 1) {
+                            ++length;
+                        }
+                        return (exponent - (int) i - 1) * (int) BITS_PER_DIGIT + length;
+                    }
+                }
+                return std::numeric_limits<int>::min();
+            }
+
+            /**
+             * @brief Approximates the number with a double, from its three leading digits. It is only
+             * meant for estimations, e.g. of the magnitude of a result.
+             */
+            double as_double() const {
+                const double base = (double) ((std::numeric_limits<T>::max() / 4) * 2);
+                double result = 0;
+
+                for (size_t i = 0; i < std::min(digits.size(), (size_t) 3); ++i) {
+                    result += (double) digits[i] * std::pow(base, this->exponent - 1 - (int) i);
+                }
+                return positive ? result : -result;
+            }
+
+            /// returns the amount of digits needed to hold the given amount of bits
+            static size_t digits_for_bits(size_t bits) {
+                return (bits + BITS_PER_DIGIT - 1) / BITS_PER_DIGIT;
+            }
+
             bool is_integral() { 
                 if (exponent < 0) {
                     return false;
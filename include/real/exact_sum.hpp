@@ -0,0 +1,279 @@
+#ifndef BOOST_REAL_EXACT_SUM_HPP
+#define BOOST_REAL_EXACT_SUM_HPP
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+#include <real/real.hpp>
+#include <real/static_real.hpp>
+
+namespace boost {
+    namespace real {
+
+        /**
+         * @brief A superaccumulator: the exact sum of exact_numbers held as a fixed point array of
+         * limbs, one per power of the digits base within the exponents added so far.
+         *
+         * The limbs are wider than the digits, so the digits of the added numbers and of the digit
+         * products are added to their limbs without propagating the carries. The carries are only
+         * propagated when the limbs could overflow and when the value is read, so a sum of n numbers
+         * of m digits costs n * m limb additions and a single normalization.
+         *
+         * @tparam T - the digits type. The limbs are long long for digits of up to 32 bits, and
+         * __int128 for 64 bits digits, which needs a compiler providing it.
+         */
+        template <typename T = int>
+        class exact_accumulator {
+#ifdef __SIZEOF_INT128__
+            using limb = std::conditional_t<sizeof(T) <= 4, long long, static_real_detail::int128>;
+            static constexpr bool WIDE_LIMBS = sizeof(T) <= 8;
+#else
+            using limb = long long;
+            static constexpr bool WIDE_LIMBS = sizeof(T) <= 4;
+#endif
+            static_assert(WIDE_LIMBS, "The limbs of the exact accumulator must be twice as wide as the digits");
+
+            static constexpr T RADIX = (std::numeric_limits<T>::max() / 4) * 2;
+
+            // numeric_limits is not specialized for __int128 in the strict standard modes
+            static constexpr limb LIMB_MAX = ((limb) 1 << (8 * sizeof(limb) - 2)) - 1 + ((limb) 1 << (8 * sizeof(limb) - 2));
+
+            // the amount of digits, each lower than RADIX, that a limb can take in without overflow
+            static constexpr limb HEADROOM = LIMB_MAX / RADIX - 2;
+
+            // _limbs[k] has the weight RADIX^(_lowest + k), the last limb is kept for the carries
+            std::vector<limb> _limbs;
+            int _lowest = 0;
+            // an upper bound of the digits added to any limb since the carries were propagated
+            limb _pending = 0;
+
+            /// makes the limbs cover the powers [lowest, highest] of the base, and a carry limb
+            void cover(int lowest, int highest) {
+                if (_limbs.empty()) {
+                    _lowest = lowest;
+                    _limbs.assign(highest - lowest + 2, 0);
+                    return;
+                }
+                if (lowest < _lowest) {
+                    _limbs.insert(_limbs.begin(), _lowest - lowest, 0);
+                    _lowest = lowest;
+                }
+                if (highest + 2 > _lowest + (int) _limbs.size()) {
+                    _limbs.resize(highest + 2 - _lowest, 0);
+                }
+            }
+
+            /// makes room in the limbs for amount more digits
+            void reserve(limb amount) {
+                if (_pending > HEADROOM - amount) {
+                    carry(_limbs);
+                    _pending = 0;
+                }
+                _pending += amount;
+            }
+
+            /**
+             * @brief Propagates the carries, every limb but the last one is then a digit, and the last
+             * one holds the sign of the value and is lower than RADIX in absolute value.
+             */
+            static void carry(std::vector<limb>& limbs) {
+                for (size_t k = 0; k + 1 < limbs.size(); k++) {
+                    limb quotient = limbs[k] / RADIX;
+                    limb remainder = limbs[k] % RADIX;
+                    if (remainder < 0) {
+                        remainder += RADIX;
+                        quotient--;
+                    }
+                    limbs[k] = remainder;
+                    limbs[k + 1] += quotient;
+                }
+                while (limbs.back() >= RADIX || limbs.back() <= -RADIX) {
+                    limb quotient = limbs.back() / RADIX;
+                    limbs.back() -= quotient * RADIX;
+                    limbs.push_back(quotient);
+                }
+            }
+
+        public:
+
+            /// adds x to the accumulator
+            void add(const exact_number<T>& x) {
+                int size = (int) x.digits.size();
+                if (size == 0) {
+                    return;
+                }
+                cover(x.exponent - size, x.exponent - 1);
+                reserve(1);
+
+                limb* top = &_limbs[x.exponent - 1 - _lowest];
+                for (int i = 0; i < size; i++) {
+                    if (x.positive) {
+                        *(top - i) += x.digits[i];
+                    } else {
+                        *(top - i) -= x.digits[i];
+                    }
+                }
+            }
+
+            /// subtracts x from the accumulator
+            void subtract(const exact_number<T>& x) {
+                exact_number<T> opposite = x;
+                opposite.positive = !x.positive;
+                add(opposite);
+            }
+
+            /// adds x * y to the accumulator, without forming the product
+            void add_product(const exact_number<T>& x, const exact_number<T>& y) {
+                int x_size = (int) x.digits.size();
+                int y_size = (int) y.digits.size();
+                if (x_size == 0 || y_size == 0) {
+                    return;
+                }
+                int exponent = x.exponent + y.exponent;
+                cover(exponent - x_size - y_size, exponent - 1);
+                bool positive = x.positive == y.positive;
+
+                // every row adds two digits at most to a limb, the low and the high half of a product
+                for (int i = 0; i < x_size; i++) {
+                    if (x.digits[i] == 0) {
+                        continue;
+                    }
+                    reserve(2);
+                    limb* top = &_limbs[exponent - 1 - _lowest];
+                    for (int j = 0; j < y_size; j++) {
+                        auto [high, low] = static_real_detail::digit_product(x.digits[i], y.digits[j], RADIX);
+                        // the product weight is RADIX^(exponent - 2 - i - j)
+                        limb* position = top - 1 - i - j;
+                        if (positive) {
+                            *position += low;
+                            *(position + 1) += high;
+                        } else {
+                            *position -= low;
+                            *(position + 1) -= high;
+                        }
+                    }
+                }
+            }
+
+            /// resets the accumulator to zero
+            void clear() {
+                _limbs.clear();
+                _lowest = 0;
+                _pending = 0;
+            }
+
+            /// the exact value of the accumulated sum
+            exact_number<T> value() const {
+                std::vector<limb> limbs = _limbs;
+                if (limbs.empty()) {
+                    return exact_number<T>(std::vector<T> {0}, 0);
+                }
+                carry(limbs);
+
+                // the lower limbs are digits, the sign is the sign of the top limb
+                bool positive = true;
+                size_t top = limbs.size();
+                while (top > 0 && limbs[top - 1] == 0) {
+                    top--;
+                }
+                if (top == 0) {
+                    return exact_number<T>(std::vector<T> {0}, 0);
+                }
+                if (limbs[top - 1] < 0) {
+                    positive = false;
+                    for (limb& l : limbs) {
+                        l = -l;
+                    }
+                    carry(limbs);
+                    while (limbs[top - 1] == 0) {
+                        top--;
+                    }
+                }
+
+                exact_number<T> result;
+                result.positive = positive;
+                result.exponent = _lowest + (int) top;
+                for (size_t k = top; k-- > 0;) {
+                    result.digits.push_back((T) limbs[k]);
+                }
+                result.normalize();
+                return result;
+            }
+        };
+
+        /// the exact sum of the numbers, computed with a boost::real::exact_accumulator
+        template <typename T>
+        exact_number<T> exact_sum(const std::vector<exact_number<T>>& numbers) {
+            exact_accumulator<T> accumulator;
+            for (const exact_number<T>& x : numbers) {
+                accumulator.add(x);
+            }
+            return accumulator.value();
+        }
+
+        /**
+         * @brief the exact dot product of x and y, computed with a boost::real::exact_accumulator
+         *
+         * @throws boost::real::exact_dot_size_mismatch_exception if x and y have different sizes.
+         */
+        template <typename T>
+        exact_number<T> exact_dot(const std::vector<exact_number<T>>& x, const std::vector<exact_number<T>>& y) {
+            if (x.size() != y.size()) {
+                throw exact_dot_size_mismatch_exception();
+            }
+            exact_accumulator<T> accumulator;
+            for (size_t i = 0; i < x.size(); i++) {
+                accumulator.add_product(x[i], y[i]);
+            }
+            return accumulator.value();
+        }
+
+        namespace exact_sum_detail {
+            template <typename T>
+            exact_number<T> explicit_value(real<T> x) {
+                const real_explicit<T>* number = std::get_if<real_explicit<T>>(&x.get_real_number());
+                if (number == nullptr) {
+                    throw invalid_representation_exception();
+                }
+                return number->get_exact_number();
+            }
+        }
+
+        /**
+         * @brief the exact sum of explicit boost::real::real numbers, as an explicit number
+         *
+         * @throws boost::real::invalid_representation_exception if a number is not explicit.
+         */
+        template <typename T>
+        real<T> exact_sum(const std::vector<real<T>>& numbers) {
+            exact_accumulator<T> accumulator;
+            for (const real<T>& x : numbers) {
+                accumulator.add(exact_sum_detail::explicit_value(x));
+            }
+            return real<T>(real_explicit<T>(accumulator.value()));
+        }
+
+        /**
+         * @brief the exact dot product of explicit boost::real::real numbers, as an explicit number
+         *
+         * @throws boost::real::exact_dot_size_mismatch_exception if x and y have different sizes.
+         * @throws boost::real::invalid_representation_exception if a number is not explicit.
+         */
+        template <typename T>
+        real<T> exact_dot(const std::vector<real<T>>& x, const std::vector<real<T>>& y) {
+            if (x.size() != y.size()) {
+                throw exact_dot_size_mismatch_exception();
+            }
+            exact_accumulator<T> accumulator;
+            for (size_t i = 0; i < x.size(); i++) {
+                accumulator.add_product(exact_sum_detail::explicit_value(x[i]), exact_sum_detail::explicit_value(y[i]));
+            }
+            return real<T>(real_explicit<T>(accumulator.value()));
+        }
+    }
+}
+
+#endif // BOOST_REAL_EXACT_SUM_HPP
@@ -0,0 +1,211 @@
+#ifndef BOOST_REAL_FIND_ROOT_HPP
+#define BOOST_REAL_FIND_ROOT_HPP
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <real/real.hpp>
+#include <real/interval_arithmetic.hpp>
+
+namespace boost {
+    namespace real {
+
+        namespace find_root_detail {
+
+            template <typename T>
+            bool contains_zero(const interval<T>& x) {
+                return (!x.positive() && !x.negative()) || x.lower_bound == literals::zero_exact<T> ||
+                       x.upper_bound == literals::zero_exact<T>;
+            }
+
+            /// the interval of x refined to bits
+            template <typename T>
+            interval<T> evaluate(const real<T>& x, size_t bits) {
+                const_precision_iterator<T> it = x.get_real_itr();
+                it.refine_to_bits(bits);
+                return it.get_interval();
+            }
+
+            /**
+             * @brief The state of a root found by boost::real::find_root, shared by the iterators of its
+             * leaf: the function, its derivative and the narrowest enclosure of the root found so far.
+             */
+            template <typename T>
+            class newton {
+                std::function<real<T>(real<T>)> _f;
+                std::function<real<T>(real<T>)> _f_prime;
+                interval<T> _enclosure;
+                // the sign of f at the lower bound of the bracket, UNDECIDED if it is not known
+                ORDER _lower_sign = ORDER::UNDECIDED;
+                // the precision of the evaluations, doubled when a step does not narrow the enclosure
+                size_t _working_bits = 2 * exact_number<T>::BITS_PER_DIGIT;
+
+                static ORDER sign(const interval<T>& x) {
+                    if (x.is_a_number() && x.lower_bound == literals::zero_exact<T>) {
+                        return ORDER::EQUAL;
+                    }
+                    if (contains_zero(x)) {
+                        return ORDER::UNDECIDED;
+                    }
+                    return x.positive() ? ORDER::GREATER : ORDER::LESS;
+                }
+
+                /**
+                 * @brief Sets the sign of f at the lower bound of the enclosure from its value there, or
+                 * from the opposite of its value at the upper bound, evaluated to the precision. It is
+                 * left UNDECIDED if both values contain zero at that precision.
+                 */
+                void update_lower_sign(size_t bits) {
+                    _lower_sign = sign(evaluate(_f(real<T>(real_explicit<T>(_enclosure.lower_bound))), bits));
+                    if (_lower_sign == ORDER::UNDECIDED) {
+                        ORDER upper_sign = sign(evaluate(_f(real<T>(real_explicit<T>(_enclosure.upper_bound))), bits));
+                        if (upper_sign == ORDER::GREATER || upper_sign == ORDER::LESS) {
+                            _lower_sign = upper_sign == ORDER::GREATER ? ORDER::LESS : ORDER::GREATER;
+                        }
+                    }
+                }
+
+                /// the precision in bits of the enclosure, see interval::tight
+                size_t accuracy() const {
+                    int width = _enclosure.width().leading_bit();
+                    if (width == std::numeric_limits<int>::min()) {
+                        return std::numeric_limits<int>::max();
+                    }
+                    int magnitude = std::max({_enclosure.lower_bound.leading_bit(), _enclosure.upper_bound.leading_bit(), 0});
+                    return (size_t) std::max(magnitude - width, 0);
+                }
+
+                /**
+                 * @brief One step of the interval Newton method at the precision, x ∩ (m - f(m) / f'(x))
+                 * for the midpoint m of the enclosure x, or a bisection step if f'(x) contains zero.
+                 *
+                 * @throws boost::real::root_not_bracketed_exception if the step proves that there is no
+                 * root in the enclosure.
+                 */
+                void step(size_t bits) {
+                    exact_number<T> half(std::vector<T> {std::numeric_limits<T>::max() / 4}, 0);
+                    exact_number<T> middle = (_enclosure.lower_bound + _enclosure.upper_bound) * half;
+                    middle = middle.up_to_bits(bits, false);
+                    if (middle < _enclosure.lower_bound) {
+                        middle = _enclosure.lower_bound;
+                    }
+                    interval<T> point;
+                    point.lower_bound = point.upper_bound = middle;
+
+                    interval<T> value = evaluate(_f(real<T>(real_explicit<T>(middle))), bits);
+                    if (sign(value) == ORDER::EQUAL) {
+                        _enclosure = point;
+                        return;
+                    }
+                    real<T> box((real_enclosure<T>(_enclosure)));
+                    interval<T> slope = evaluate(_f_prime(box), bits);
+
+                    if (!contains_zero(slope)) {
+                        interval<T> newton = sub(point, div(value, slope, bits), bits);
+                        exact_number<T> lower = std::max(_enclosure.lower_bound, newton.lower_bound);
+                        exact_number<T> upper = std::min(_enclosure.upper_bound, newton.upper_bound);
+                        if (upper < lower) {
+                            throw root_not_bracketed_exception();
+                        }
+                        _enclosure.lower_bound = lower;
+                        _enclosure.upper_bound = upper;
+                        return;
+                    }
+
+                    // the root is on the side of the midpoint where f changes its sign. The sign at
+                    // the bounds may only be known at a higher precision than the previous steps.
+                    if (_lower_sign == ORDER::UNDECIDED) {
+                        update_lower_sign(bits);
+                    }
+                    ORDER middle_sign = sign(value);
+                    if (middle_sign == ORDER::UNDECIDED || _lower_sign == ORDER::UNDECIDED) {
+                        return;
+                    }
+                    if (middle_sign == _lower_sign) {
+                        _enclosure.lower_bound = middle;
+                    } else {
+                        _enclosure.upper_bound = middle;
+                    }
+                }
+
+            public:
+
+                newton(std::function<real<T>(real<T>)> f, std::function<real<T>(real<T>)> f_prime, const interval<T>& bracket)
+                    : _f(std::move(f)), _f_prime(std::move(f_prime)), _enclosure(bracket) {
+                    update_lower_sign(_working_bits);
+                }
+
+                const interval<T>& enclosure() const {
+                    return _enclosure;
+                }
+
+                /**
+                 * @brief Narrows the enclosure until it is tight to the precision in bits. The evaluations
+                 * precision follows the quadratic convergence of the method: each step is evaluated with
+                 * twice the bits of the current enclosure, and the precision is doubled when a step does
+                 * not narrow the enclosure.
+                 *
+                 * @throws boost::real::precision_exception if the steps do not narrow the enclosure at
+                 * four times the requested precision, e.g. for a multiple root.
+                 */
+                interval<T> refine(size_t bits) {
+                    size_t maximum_bits = 4 * (bits + 2 * exact_number<T>::BITS_PER_DIGIT);
+                    while (!_enclosure.tight(bits)) {
+                        size_t target = std::min(2 * accuracy() + exact_number<T>::BITS_PER_DIGIT,
+                                                 bits + 2 * exact_number<T>::BITS_PER_DIGIT);
+                        size_t working_bits = std::max(_working_bits, target);
+                        int width = _enclosure.width().leading_bit();
+
+                        step(working_bits);
+                        if (!(_enclosure.width().leading_bit() < width)) {
+                            _working_bits = 2 * working_bits;
+                            if (_working_bits > maximum_bits) {
+                                throw precision_exception();
+                            }
+                        }
+                    }
+                    return _enclosure;
+                }
+            };
+        }
+
+        /**
+         * @brief Returns the root of f in the bracket, as a leaf refined by the interval Newton method.
+         *
+         * Every refinement of the leaf to a precision continues the Newton iteration from the
+         * narrowest enclosure found so far, so the root is computed lazily and only once for all the
+         * numbers using it. f and f_prime are evaluated on boost::real::real numbers: at the midpoint of
+         * the enclosure for f, and at the enclosure itself, as a leaf, for f_prime. When the enclosure
+         * of f_prime contains zero, the step bisects the enclosure on the sign of f instead.
+         *
+         * @param f - the function, which builds a boost::real::real number from its argument.
+         * @param f_prime - the derivative of f.
+         * @param bracket - an interval which contains a single root of f.
+         *
+         * @throws boost::real::root_not_bracketed_exception, when the leaf is refined, if the
+         * iteration proves that the bracket has no root.
+         */
+        template <typename T, typename F, typename G>
+        real<T> find_root(F f, G f_prime, const interval<T>& bracket) {
+            auto state = std::make_shared<find_root_detail::newton<T>>(f, f_prime, bracket);
+            real_enclosure<T> leaf(bracket, [state] (size_t bits) {
+                return state->refine(bits);
+            });
+            return real<T>(leaf);
+        }
+
+        /// find_root in the bracket [lower, upper] of numbers
+        template <typename T, typename F, typename G>
+        real<T> find_root(F f, G f_prime, const real<T>& lower, const real<T>& upper) {
+            interval<T> bracket;
+            bracket.lower_bound = find_root_detail::evaluate(lower, 2 * exact_number<T>::BITS_PER_DIGIT).lower_bound;
+            bracket.upper_bound = find_root_detail::evaluate(upper, 2 * exact_number<T>::BITS_PER_DIGIT).upper_bound;
+            return find_root(f, f_prime, bracket);
+        }
+    }
+}
+
+#endif // BOOST_REAL_FIND_ROOT_HPP
@@ -1,6 +1,8 @@
 #ifndef BOOST_REAL_INTERVAL_HPP
 #define BOOST_REAL_INTERVAL_HPP
 
+#include <algorithm>
+#include <limits>
 #include <vector>
 
 #include <real/exact_number.hpp>
@@ -119,6 +121,31 @@ namespace boost {
                 return this->lower_bound == this->upper_bound;
             }
 
+            /**
+             * @brief Calculates the interval width, i.e. the distance between both boundaries.
+             *
+             * @return an exact_number equal to upper boundary - lower boundary.
+             */
+            exact_number<T> width() const {
+                exact_number<T> upper = this->upper_bound;
+                exact_number<T> result = upper - this->lower_bound;
+                result.normalize();
+                return result;
+            }
+
+            /**
+             * @brief Determines if the interval is tight to a precision in bits: its width is at
+             * most about 2^-bits times the magnitude of its bounds, or 2^-bits if they are lower than one.
+             */
+            bool tight(size_t bits) const {
+                int width = this->width().leading_bit();
+                if (width == std::numeric_limits<int>::min()) {
+                    return true;
+                }
+                int magnitude = std::max({this->lower_bound.leading_bit(), this->upper_bound.leading_bit(), 0});
+                return width <= magnitude - (int) bits;
+            }
+
             friend std::ostream& operator<<(std::ostream& os, const boost::real::interval<T>& interval) {
                 return os << interval.as_string();
             }
@@ -0,0 +1,277 @@
+#ifndef BOOST_REAL_INTERVAL_ARITHMETIC_HPP
+#define BOOST_REAL_INTERVAL_ARITHMETIC_HPP
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <real/interval.hpp>
+#include <real/exact_number.hpp>
+#include <real/real_math.hpp>
+#include <real/real_exception.hpp>
+
+namespace boost {
+    namespace real {
+
+        /**
+         * @brief Outward rounded arithmetic on boost::real::interval at an explicit precision.
+         *
+         * These functions apply the exact_number kernels of the operation trees to intervals directly,
+         * without building nodes or iterators, so a loop whose precision is known in advance runs at the
+         * kernels speed. Every result bound is rounded away from the interval to the given amount of
+         * significant bits, so the result contains the result of the operation on any numbers of the
+         * operands. Refining a result needs its operands again, the lazy boost::real::real numbers do it
+         * automatically.
+         */
+        namespace interval_arithmetic_detail {
+            template <typename T>
+            interval<T> rounded(const exact_number<T>& lower, const exact_number<T>& upper, size_t bits) {
+                interval<T> result;
+                result.lower_bound = lower.up_to_bits(bits, false);
+                result.upper_bound = upper.up_to_bits(bits, true);
+                return result;
+            }
+
+            /// x / y rounded towards +infinity if upper, else towards -infinity
+            template <typename T>
+            exact_number<T> quotient(const exact_number<T>& x, const exact_number<T>& y, size_t bits, bool upper) {
+                exact_number<T> result = x;
+                // the division rounds the magnitude of the result
+                result.divide_vector_bits(y, bits, upper == (x.positive == y.positive));
+                return result;
+            }
+        }
+
+        /// encloses x + y, rounded outward to bits significant bits
+        template <typename T>
+        interval<T> add(const interval<T>& x, const interval<T>& y, size_t bits) {
+            return interval_arithmetic_detail::rounded(
+                x.lower_bound.up_to_bits(bits, false) + y.lower_bound.up_to_bits(bits, false),
+                x.upper_bound.up_to_bits(bits, true) + y.upper_bound.up_to_bits(bits, true), bits);
+        }
+
+        /// encloses x - y, rounded outward to bits significant bits
+        template <typename T>
+        interval<T> sub(const interval<T>& x, const interval<T>& y, size_t bits) {
+            return interval_arithmetic_detail::rounded(
+                x.lower_bound.up_to_bits(bits, false) - y.upper_bound.up_to_bits(bits, true),
+                x.upper_bound.up_to_bits(bits, true) - y.lower_bound.up_to_bits(bits, false), bits);
+        }
+
+        /// encloses x * y, rounded outward to bits significant bits
+        template <typename T>
+        interval<T> mul(const interval<T>& x, const interval<T>& y, size_t bits) {
+            exact_number<T> x_lower = x.lower_bound.up_to_bits(bits, false);
+            exact_number<T> x_upper = x.upper_bound.up_to_bits(bits, true);
+            exact_number<T> y_lower = y.lower_bound.up_to_bits(bits, false);
+            exact_number<T> y_upper = y.upper_bound.up_to_bits(bits, true);
+
+            if (x.lower_bound.positive && y.lower_bound.positive) {
+                return interval_arithmetic_detail::rounded(x_lower * y_lower, x_upper * y_upper, bits);
+            }
+
+            // one of the operands is not positive, the bounds are among all the products
+            exact_number<T> products[] = {x_lower * y_lower, x_lower * y_upper, x_upper * y_lower, x_upper * y_upper};
+            return interval_arithmetic_detail::rounded(*std::min_element(products, products + 4),
+                                                       *std::max_element(products, products + 4), bits);
+        }
+
+        /**
+         * @brief encloses x / y, rounded outward to bits significant bits
+         *
+         * @throws boost::real::divergent_division_result_exception if y contains zero.
+         */
+        template <typename T>
+        interval<T> div(const interval<T>& x, const interval<T>& y, size_t bits) {
+            using interval_arithmetic_detail::quotient;
+
+            if ((!y.positive() && !y.negative()) || y.lower_bound == literals::zero_exact<T> ||
+                y.upper_bound == literals::zero_exact<T>) {
+                throw divergent_division_result_exception();
+            }
+
+            interval<T> result;
+            if (y.positive()) {
+                result.lower_bound = quotient(x.lower_bound, x.lower_bound.positive ? y.upper_bound : y.lower_bound, bits, false);
+                result.upper_bound = quotient(x.upper_bound, x.upper_bound.positive ? y.lower_bound : y.upper_bound, bits, true);
+            } else {
+                result.lower_bound = quotient(x.upper_bound, x.upper_bound.positive ? y.upper_bound : y.lower_bound, bits, false);
+                result.upper_bound = quotient(x.lower_bound, x.lower_bound.positive ? y.lower_bound : y.upper_bound, bits, true);
+            }
+            return result;
+        }
+
+        /**
+         * @brief encloses the square root of the non negative part of x, rounded outward to bits
+         * significant bits
+         *
+         * @throws boost::real::square_root_not_defined_for_negative_number if x is negative.
+         */
+        template <typename T>
+        interval<T> sqrt(const interval<T>& x, size_t bits) {
+            if (x.upper_bound < literals::zero_exact<T>) {
+                throw square_root_not_defined_for_negative_number();
+            }
+
+            interval<T> result;
+            if (x.lower_bound.positive) {
+                result.lower_bound = square_root(x.lower_bound, bits, false);
+            }
+            result.upper_bound = square_root(x.upper_bound, bits, true);
+            return result;
+        }
+
+        /// encloses e^x, rounded outward to bits significant bits
+        template <typename T>
+        interval<T> exp(const interval<T>& x, size_t bits) {
+            interval<T> result;
+            result.lower_bound = exponent(x.lower_bound.up_to_bits(bits, false), bits, false, PRECISION_MODE::RELATIVE);
+            result.upper_bound = exponent(x.upper_bound.up_to_bits(bits, true), bits, true, PRECISION_MODE::RELATIVE);
+            return result;
+        }
+
+        /**
+         * @brief encloses sin(x) and cos(x) together, with an absolute error of at most 2^-bits
+         * on each bound
+         *
+         * The series are summed once for both at each bound of x. A bound of sin(x) is -1 or 1 when cos(x)
+         * may change its sign on x, in the direction of the change, and likewise for cos(x) and
+         * sin(x). Both are [-1, 1] when x is wider than 3, which may hold more than one extremum.
+         */
+        template <typename T>
+        std::pair<interval<T>, interval<T>> sin_cos(const interval<T>& x, size_t bits) {
+            exact_number<T> one = literals::one_exact<T>;
+            exact_number<T> minus_one = one;
+            minus_one.positive = false;
+            interval<T> unit;
+            unit.lower_bound = minus_one;
+            unit.upper_bound = one;
+            if (exact_number<T>(std::vector<T> {3}, 1) < x.width()) {
+                return {unit, unit};
+            }
+
+            // the values at the bounds, widened by the error of the series
+            exact_number<T> error = exact_number<T>::error_bound(bits);
+            auto bound = [&error, bits] (const exact_number<T>& point, bool upper) {
+                auto [sin, cos] = sin_cos(point, bits, upper);
+                interval<T> sin_interval;
+                sin_interval.lower_bound = (sin - error).up_to_bits(bits, false);
+                sin_interval.upper_bound = (sin + error).up_to_bits(bits, true);
+                interval<T> cos_interval;
+                cos_interval.lower_bound = (cos - error).up_to_bits(bits, false);
+                cos_interval.upper_bound = (cos + error).up_to_bits(bits, true);
+                return std::make_pair(sin_interval, cos_interval);
+            };
+            // the rounded bounds contain x, so the range on them contains the range on x
+            auto [sin_lower, cos_lower] = bound(x.lower_bound.up_to_bits(bits, false), false);
+            auto [sin_upper, cos_upper] = bound(x.upper_bound.up_to_bits(bits, true), true);
+
+            auto strictly_positive = [] (const interval<T>& y) {
+                return y.positive() && !(y.lower_bound == literals::zero_exact<T>);
+            };
+            auto strictly_negative = [] (const interval<T>& y) {
+                return y.negative() && !(y.upper_bound == literals::zero_exact<T>);
+            };
+
+            // the hull of the values at the bounds, extended to the extrema which the derivative allows
+            auto range = [&] (const interval<T>& lower, const interval<T>& upper,
+                              bool maximum, bool minimum) {
+                interval<T> result;
+                result.lower_bound = std::min(lower.lower_bound, upper.lower_bound);
+                result.upper_bound = std::max(lower.upper_bound, upper.upper_bound);
+                if (maximum || one < result.upper_bound) {
+                    result.upper_bound = one;
+                }
+                if (minimum || result.lower_bound < minus_one) {
+                    result.lower_bound = minus_one;
+                }
+                return result;
+            };
+
+            // sin' = cos and cos' = -sin, an extremum is where the derivative may change its sign
+            interval<T> sin_result = range(sin_lower, sin_upper,
+                !strictly_negative(cos_lower) && !strictly_positive(cos_upper),
+                !strictly_positive(cos_lower) && !strictly_negative(cos_upper));
+            interval<T> cos_result = range(cos_lower, cos_upper,
+                !strictly_positive(sin_lower) && !strictly_negative(sin_upper),
+                !strictly_negative(sin_lower) && !strictly_positive(sin_upper));
+            return {sin_result, cos_result};
+        }
+
+        /**
+         * @brief encloses log(x), rounded outward to bits significant bits
+         *
+         * @throws boost::real::logarithm_not_defined_for_non_positive_number if x is not positive.
+         */
+        template <typename T>
+        interval<T> log(const interval<T>& x, size_t bits) {
+            if (!x.lower_bound.positive || x.lower_bound == literals::zero_exact<T>) {
+                throw logarithm_not_defined_for_non_positive_number();
+            }
+
+            interval<T> result;
+            result.lower_bound = logarithm(x.lower_bound.up_to_bits(bits, false), bits, false, PRECISION_MODE::RELATIVE);
+            result.upper_bound = logarithm(x.upper_bound.up_to_bits(bits, true), bits, true, PRECISION_MODE::RELATIVE);
+            return result;
+        }
+
+        /**
+         * @brief encloses the polynomial with the given coefficients at x, the coefficient of x^k at
+         * index k, rounded outward to bits significant bits
+         *
+         * The result is the intersection of the Horner scheme on x and of the centered form
+         * p(c) + p'(x) (x - c), where c is the midpoint of x. The centered form uses x only once in
+         * its error term, so its width shrinks with the square of the width of x, while the Horner
+         * scheme on x overestimates the range by the dependency between the occurrences of x.
+         */
+        template <typename T>
+        interval<T> polynomial(const std::vector<interval<T>>& coefficients, const interval<T>& x, size_t bits) {
+            if (coefficients.empty()) {
+                interval<T> zero;
+                zero.lower_bound = zero.upper_bound = exact_number<T>(std::vector<T> {0}, 0);
+                return zero;
+            }
+
+            size_t degree = coefficients.size() - 1;
+            interval<T> horner = coefficients[degree];
+            for (size_t k = degree; k-- > 0;) {
+                horner = add(mul(horner, x, bits), coefficients[k], bits);
+            }
+            if (degree == 0 || x.is_a_number()) {
+                return horner;
+            }
+
+            // the midpoint is exact, since the base is even
+            exact_number<T> half(std::vector<T> {(std::numeric_limits<T>::max() / 4)}, 0);
+            interval<T> center;
+            center.lower_bound = (x.lower_bound + x.upper_bound) * half;
+            center.lower_bound.normalize();
+            center.upper_bound = center.lower_bound;
+
+            auto integer = [] (size_t k) {
+                interval<T> result;
+                result.lower_bound = result.upper_bound = exact_number<T>(std::vector<T> {(T) k}, 1);
+                return result;
+            };
+
+            // p(c) and p'(x) with the Horner scheme
+            interval<T> value = coefficients[degree];
+            interval<T> slope = mul(coefficients[degree], integer(degree), bits);
+            for (size_t k = degree; k-- > 0;) {
+                value = add(mul(value, center, bits), coefficients[k], bits);
+                if (k > 0) {
+                    slope = add(mul(slope, x, bits), mul(coefficients[k], integer(k), bits), bits);
+                }
+            }
+            interval<T> centered = add(value, mul(slope, sub(x, center, bits), bits), bits);
+
+            interval<T> result;
+            result.lower_bound = std::max(horner.lower_bound, centered.lower_bound);
+            result.upper_bound = std::min(horner.upper_bound, centered.upper_bound);
+            return result;
+        }
+    }
+}
+
+#endif //BOOST_REAL_INTERVAL_ARITHMETIC_HPP
@@ -0,0 +1,212 @@
+#ifndef BOOST_REAL_NODE_TABLE_HPP
+#define BOOST_REAL_NODE_TABLE_HPP
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <real/real_data.hpp>
+
+namespace boost {
+    namespace real {
+
+        /**
+         * @brief The automatic materialization policy of boost::real::node_table: operations
+         * deeper than maximum_depth are materialized at precision as soon as they are built. A
+         * maximum_depth of zero disables it, and a precision of zero uses the node maximum precision.
+         */
+        struct materialization_policy {
+            size_t maximum_depth = 0;
+            precision_t precision = 0;
+        };
+
+        /**
+         * @brief The factory of the nodes of the boost::real::real numbers DAG, with optional
+         * hash-consing and automatic materialization.
+         *
+         * When hash_consing is enabled, building an operation whose operation and operands are
+         * those of a live node returns that node, and building an explicit leaf whose value is that
+         * of a live leaf returns that leaf. Structurally identical subexpressions, such as the two
+         * a * b of a * b + a * b * c, are then a single node with a single iterator and enclosure,
+         * so they are evaluated once.
+         *
+         * The table only holds weak references, a node is removed from it when its last number is
+         * destroyed. Since operands are identified by address, an entry is only valid while its
+         * node lives, which keeps its operands alive too.
+         *
+         * Numbers sharing a node share its approximation and its maximum precision, so
+         * set_maximum_precision on one of them applies to all of them. The table is not thread safe.
+         */
+        template <typename T = int>
+        class node_table {
+            using node = std::shared_ptr<real_data<T>>;
+
+            struct operation_key {
+                OPERATION operation;
+                const real_data<T>* lhs;
+                const real_data<T>* rhs;
+
+                bool operator==(const operation_key& other) const {
+                    return operation == other.operation && lhs == other.lhs && rhs == other.rhs;
+                }
+            };
+
+            struct leaf_key {
+                std::vector<T> digits;
+                int exponent;
+                bool positive;
+
+                bool operator==(const leaf_key& other) const {
+                    return exponent == other.exponent && positive == other.positive && digits == other.digits;
+                }
+            };
+
+            static size_t combine(size_t seed, size_t value) {
+                return seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+            }
+
+            struct operation_hash {
+                size_t operator()(const operation_key& key) const {
+                    size_t seed = std::hash<int>()((int) key.operation);
+                    seed = combine(seed, std::hash<const void*>()(key.lhs));
+                    return combine(seed, std::hash<const void*>()(key.rhs));
+                }
+            };
+
+            struct leaf_hash {
+                size_t operator()(const leaf_key& key) const {
+                    size_t seed = combine(std::hash<int>()(key.exponent), key.positive);
+                    for (T digit : key.digits) {
+                        seed = combine(seed, std::hash<T>()(digit));
+                    }
+                    return seed;
+                }
+            };
+
+            inline static std::unordered_map<operation_key, std::weak_ptr<real_data<T>>, operation_hash> _operations;
+            inline static std::unordered_map<leaf_key, std::weak_ptr<real_data<T>>, leaf_hash> _leaves;
+            // the tables are swept of their expired entries when they reach this size
+            inline static size_t _sweep_size = 1024;
+
+            template <typename Map>
+            static void sweep(Map& table) {
+                for (auto it = table.begin(); it != table.end();) {
+                    it = it->second.expired() ? table.erase(it) : std::next(it);
+                }
+            }
+
+            template <typename Map, typename Key, typename Value>
+            static node find_or_insert(Map& table, Key&& key, Value&& value) {
+                auto it = table.find(key);
+                if (it != table.end()) {
+                    if (node existing = it->second.lock()) {
+                        return existing;
+                    }
+                }
+                node result = std::make_shared<real_data<T>>(std::forward<Value>(value));
+                table[std::forward<Key>(key)] = result;
+
+                if (_operations.size() + _leaves.size() >= _sweep_size) {
+                    sweep(_operations);
+                    sweep(_leaves);
+                    _sweep_size = std::max<size_t>(1024, 2 * (_operations.size() + _leaves.size()));
+                }
+                return result;
+            }
+
+            static node intern(real_operation<T>& operation) {
+                // the key does not hold the coefficients of polynomials nor the user defined functions
+                if (!hash_consing || operation.get_operation() == OPERATION::POLYNOMIAL || operation.get_operation() == OPERATION::FUNCTION) {
+                    return std::make_shared<real_data<T>>(operation);
+                }
+                operation_key key {operation.get_operation(), operation.lhs().get(), operation.rhs().get()};
+                return find_or_insert(_operations, key, operation);
+            }
+
+        public:
+
+            /// if true, equal nodes are shared. It is false by default.
+            inline static bool hash_consing = false;
+
+            /// the automatic materialization of deep operations, disabled by default
+            inline static materialization_policy automatic_materialization;
+
+            /**
+             * @brief returns the node of the operation, which is an existing equal node if
+             * hash_consing is enabled, or its materialization if it is deeper than the
+             * automatic_materialization maximum depth.
+             */
+            static node make(real_operation<T> operation) {
+                node result = intern(operation);
+                if (automatic_materialization.maximum_depth != 0 && result->depth() > automatic_materialization.maximum_depth &&
+                    !result->reactive()) {
+                    return materialize(result, automatic_materialization.precision);
+                }
+                return result;
+            }
+
+            /**
+             * @brief Returns a leaf with the value of the operation x: its approximation interval at
+             * the precision, as a real_enclosure, or an explicit leaf if that interval is a single
+             * number. x itself is refined to the precision. Leaves are returned unchanged.
+             *
+             * @param precision - the precision to evaluate x to, its maximum precision if zero.
+             */
+            static node materialize(const node& x, precision_t precision) {
+                if (std::get_if<real_operation<T>>(x->get_real_ptr()) == nullptr) {
+                    return x;
+                }
+                const_precision_iterator<T>& it = x->get_precision_itr();
+                if (precision == 0) {
+                    precision = it.maximum_precision();
+                }
+                if (it.get_precision() < precision) {
+                    it.iterate_n_times(precision - it.get_precision());
+                }
+
+                interval<T> enclosure = it.get_interval();
+                if (enclosure.is_a_number()) {
+                    exact_number<T> value = enclosure.lower_bound;
+                    value.normalize();
+                    if (value.digits.empty()) {
+                        value = exact_number<T>(std::vector<T> {0}, 0);
+                    }
+                    return make(real_explicit<T>(value));
+                }
+                return std::make_shared<real_data<T>>(real_enclosure<T>(enclosure));
+            }
+
+            /// returns the node of the leaf, which is an existing leaf of the same value if hash_consing is enabled
+            static node make(real_explicit<T> leaf) {
+                if (!hash_consing) {
+                    return std::make_shared<real_data<T>>(leaf);
+                }
+                const exact_number<T>& value = leaf.get_exact_number();
+                leaf_key key {value.digits, value.exponent, value.positive};
+                return find_or_insert(_leaves, key, leaf);
+            }
+
+            /// the number of live nodes in the table
+            static size_t size() {
+                size_t live = 0;
+                for (const auto& entry : _operations) {
+                    live += !entry.second.expired();
+                }
+                for (const auto& entry : _leaves) {
+                    live += !entry.second.expired();
+                }
+                return live;
+            }
+
+            /// forgets all the nodes, the existing numbers are not modified
+            static void clear() {
+                _operations.clear();
+                _leaves.clear();
+            }
+        };
+    }
+}
+
+#endif // BOOST_REAL_NODE_TABLE_HPP
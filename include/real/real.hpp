@@ -17,6 +17,11 @@
 #include <real/real_operation.hpp>
 #include <real/const_precision_iterator.hpp>
 #include <real/real_data.hpp>
+#include <real/approximation.hpp>
+#include <real/comparison.hpp>
+#include <real/node_table.hpp>
+#include <real/simplification.hpp>
+#include <real/interval_arithmetic.hpp>
 
 
 namespace boost {
@@ -30,6 +35,17 @@ namespace boost {
          **/
         enum class TYPE{EXPLICIT, INTEGER, RATIONAL, ALGORITHM, OPERATION};
 
+        template <typename T>
+        class real_input;
+
+        template <typename T>
+        class snapshot;
+
+        namespace sorting_detail {
+            template <typename T>
+            struct ranked;
+        }
+
         /**
          * @author Laouen Mayal Louan Belloli
          *
@@ -68,11 +84,222 @@ namespace boost {
         /// @TODO: replace T with something more descriptive 
         template <typename T = int>
         class real {
+            friend class real_input<T>;
+            friend class snapshot<T>;
+            friend struct sorting_detail::ranked<T>;
+
         private:
             std::shared_ptr<real_data<T>> _real_p;
-            // ctor from shared_ptr to (already init) real_data. used in check_and_distribute.
+            // ctor from shared_ptr to (already init) real_data.
             real(std::shared_ptr<real_data<T>> x) : _real_p(x){};
 
+            /// the integer as an exact number
+            static exact_number<T> to_exact(const integer_number<T>& integer, bool positive = true) {
+                if (integer == literals::zero_integer<T>) {
+                    return exact_number<T>(std::vector<T> {0}, 0);
+                }
+                exact_number<T> result = real_explicit<T>(integer).get_exact_number();
+                result.positive = positive;
+                return result;
+            }
+
+            /// the explicit leaf of an exact number
+            static real<T> from_exact(exact_number<T> value) {
+                value.normalize();
+                if (value.digits.empty()) {
+                    value = exact_number<T>(std::vector<T> {0}, 0);
+                }
+                return real<T>(node_table<T>::make(real_explicit<T>(value)));
+            }
+
+            /// the exact quotient numerator / denominator: a leaf if the denominator is one, a single division otherwise
+            static real<T> from_quotient(const exact_number<T>& numerator, const exact_number<T>& denominator) {
+                if (denominator == literals::one_exact<T>) {
+                    return from_exact(numerator);
+                }
+                real<T> a = from_exact(numerator);
+                real<T> b = from_exact(denominator);
+                return real<T>(node_table<T>::make(real_operation<T>(a._real_p, b._real_p, OPERATION::DIVISION)));
+            }
+
+            /// the real_explicit or real_operation equivalent of a rational number, which can be iterated
+            static real<T> from_rational(const real_rational<T>& rat_num) {
+                return from_quotient(to_exact(rat_num.a, rat_num.positive), to_exact(rat_num.b));
+            }
+
+            /**
+             * @brief Returns lhs op rhs, for the four arithmetic operations, exactly whenever the
+             * operands allow it: rational with rational gives a rational, and a rational n / d with
+             * an explicit number e gives a single explicit leaf if d is one, or a single division of
+             * two explicit leaves otherwise, as (n + e * d) / d or (n * e) / d. The other operands
+             * give an operation node, the rationals being converted by from_rational.
+             */
+            static real<T> arithmetic(OPERATION op, const real<T>& lhs, const real<T>& rhs) {
+                // rational op explicit, or explicit op rational if the rational is on the right
+                auto mixed = [op] (const real_rational<T>& rat, exact_number<T> e, bool rational_first) {
+                    exact_number<T> n = to_exact(rat.a, rat.positive);
+                    exact_number<T> d = to_exact(rat.b);
+                    switch (op) {
+                        case OPERATION::ADDITION:
+                            return from_quotient(n + e * d, d);
+                        case OPERATION::SUBTRACTION:
+                            return rational_first ? from_quotient(n - e * d, d) : from_quotient(e * d - n, d);
+                        case OPERATION::MULTIPLICATION:
+                            return from_quotient(n * e, d);
+                        default:
+                            return rational_first ? from_quotient(n, d * e) : from_quotient(e * d, n);
+                    }
+                };
+
+                // the values of inputs are not folded, they may change
+                if (lhs._real_p->reactive() || rhs._real_p->reactive()) {
+                    std::shared_ptr<real_data<T>> l = lhs._real_p;
+                    std::shared_ptr<real_data<T>> r = rhs._real_p;
+                    return real<T>(node_table<T>::make(real_operation<T>(l, r, op)));
+                }
+
+                return std::visit(overloaded {
+                    [op] (real_rational<T> a, real_rational<T> b) {
+                        switch (op) {
+                            case OPERATION::ADDITION:
+                                return real<T>(std::make_shared<real_data<T>>(real_rational<T>(a + b)));
+                            case OPERATION::SUBTRACTION:
+                                return real<T>(std::make_shared<real_data<T>>(real_rational<T>(a - b)));
+                            case OPERATION::MULTIPLICATION:
+                                return real<T>(std::make_shared<real_data<T>>(real_rational<T>(a * b)));
+                            default:
+                                return real<T>(std::make_shared<real_data<T>>(real_rational<T>(a / b)));
+                        }
+                    },
+                    [&mixed] (const real_rational<T>& rat, const real_explicit<T>& e) {
+                        return mixed(rat, e.get_exact_number(), true);
+                    },
+                    [&mixed] (const real_explicit<T>& e, const real_rational<T>& rat) {
+                        return mixed(rat, e.get_exact_number(), false);
+                    },
+                    [op, &rhs] (const real_rational<T>& rat, const auto&) {
+                        real<T> a = from_rational(rat);
+                        std::shared_ptr<real_data<T>> b = rhs._real_p;
+                        return real<T>(node_table<T>::make(real_operation<T>(a._real_p, b, op)));
+                    },
+                    [op, &lhs] (const auto&, const real_rational<T>& rat) {
+                        std::shared_ptr<real_data<T>> a = lhs._real_p;
+                        real<T> b = from_rational(rat);
+                        return real<T>(node_table<T>::make(real_operation<T>(a, b._real_p, op)));
+                    },
+                    [op, &lhs, &rhs] (const auto&, const auto&) {
+                        std::shared_ptr<real_data<T>> l = lhs._real_p;
+                        std::shared_ptr<real_data<T>> r = rhs._real_p;
+                        return real<T>(node_table<T>::make(real_operation<T>(l, r, op)));
+                    }
+                }, lhs._real_p->get_real_number(), rhs._real_p->get_real_number());
+            }
+
+            /**
+             * @brief Returns the sign of the number when it is known without evaluating it: for
+             * explicit and rational leaves, for a difference of a node with itself, for exponentials,
+             * and for sums, products and quotients of operands whose sign is known. Deeper trees than
+             * max_depth are not inspected.
+             */
+            static std::optional<ORDER> structural_sign(const std::shared_ptr<real_data<T>>& x, int max_depth = 64) {
+                if (max_depth == 0) {
+                    return std::nullopt;
+                }
+                return std::visit(overloaded {
+                    [] (const real_explicit<T>& real) -> std::optional<ORDER> {
+                        bool zero = std::all_of(real.digits().begin(), real.digits().end(), [] (T digit) {
+                            return digit == 0;
+                        });
+                        if (zero) {
+                            return ORDER::EQUAL;
+                        }
+                        return real.positive() ? ORDER::GREATER : ORDER::LESS;
+                    },
+                    [] (const real_rational<T>& real) -> std::optional<ORDER> {
+                        if (real.a == literals::zero_integer<T>) {
+                            return ORDER::EQUAL;
+                        }
+                        return real > literals::zero_integer<T> ? ORDER::GREATER : ORDER::LESS;
+                    },
+                    [max_depth] (const real_operation<T>& real) -> std::optional<ORDER> {
+                        if (real.get_operation() == OPERATION::EXPONENT) {
+                            return ORDER::GREATER;
+                        }
+                        if (real.get_operation() == OPERATION::SUBTRACTION && real.lhs() == real.rhs()) {
+                            return ORDER::EQUAL;
+                        }
+                        if (real.get_operation() != OPERATION::ADDITION && real.get_operation() != OPERATION::SUBTRACTION &&
+                            real.get_operation() != OPERATION::MULTIPLICATION && real.get_operation() != OPERATION::DIVISION) {
+                            return std::nullopt;
+                        }
+
+                        std::optional<ORDER> lhs = structural_sign(real.lhs(), max_depth - 1);
+                        std::optional<ORDER> rhs = structural_sign(real.rhs(), max_depth - 1);
+                        if (real.get_operation() == OPERATION::MULTIPLICATION &&
+                            (lhs == ORDER::EQUAL || rhs == ORDER::EQUAL)) {
+                            return ORDER::EQUAL;
+                        }
+                        if (!lhs || !rhs) {
+                            return std::nullopt;
+                        }
+                        if (real.get_operation() == OPERATION::SUBTRACTION) { // a - b = a + (-b)
+                            rhs = *rhs == ORDER::GREATER ? ORDER::LESS : *rhs == ORDER::LESS ? ORDER::GREATER : ORDER::EQUAL;
+                        }
+
+                        switch (real.get_operation()) {
+                            case OPERATION::ADDITION:
+                            case OPERATION::SUBTRACTION:
+                                if (*lhs == ORDER::EQUAL || *lhs == *rhs) {
+                                    return rhs;
+                                }
+                                if (*rhs == ORDER::EQUAL) {
+                                    return lhs;
+                                }
+                                return std::nullopt; // opposite signs
+                            case OPERATION::DIVISION:
+                                if (*rhs == ORDER::EQUAL) { // the division throws when it is evaluated
+                                    return std::nullopt;
+                                }
+                                [[fallthrough]];
+                            default:
+                                if (*lhs == ORDER::EQUAL) {
+                                    return ORDER::EQUAL;
+                                }
+                                return *lhs == *rhs ? ORDER::GREATER : ORDER::LESS;
+                        }
+                    },
+                    [] (const real_enclosure<T>& real) -> std::optional<ORDER> {
+                        if (literals::zero_exact<T> < real.get_interval().lower_bound) {
+                            return ORDER::GREATER;
+                        }
+                        if (real.get_interval().upper_bound < literals::zero_exact<T>) {
+                            return ORDER::LESS;
+                        }
+                        return std::nullopt;
+                    },
+                    [] (const auto&) -> std::optional<ORDER> {
+                        return std::nullopt;
+                    }
+                }, x->get_real_number());
+            }
+
+            /**
+             * @brief Second tier of the comparison filter, used when the double enclosures overlap.
+             * Returns -1 if *this < other and 1 if *this > other according to the double-double
+             * enclosures, or 0 if those overlap too and the exact engine has to decide.
+             */
+            int double_double_order(const real<T>& other) const {
+                const double_double_interval& this_enclosure = this->_real_p->double_double_enclosure();
+                const double_double_interval& other_enclosure = other._real_p->double_double_enclosure();
+                if (this_enclosure < other_enclosure) {
+                    return -1;
+                }
+                if (this_enclosure > other_enclosure) {
+                    return 1;
+                }
+                return 0;
+            }
+
         public:
             /// @TODO: Move constructors to move directly from the ctors in real_explicit to the values in real_data
             /// @TODO: do we need different ctors to be more efficient? rvalue AND lvalue ref?
@@ -105,7 +332,7 @@ namespace boost {
                     auto [integer_part, decimal_part, exponent, positive] = exact_number<>::number_from_string(number);
 
                     if ((int)(decimal_part.length() + integer_part.length()) <= exponent) {
-                        this->_real_p = std::make_shared<real_data<T>>(real_explicit<T>(integer_part, decimal_part, exponent, positive));
+                        this->_real_p = node_table<T>::make(real_explicit<T>(integer_part, decimal_part, exponent, positive));
                     } else {
                         int zeroes = decimal_part.length() + integer_part.length() - exponent;
                         std::string denominator = "1";
@@ -116,10 +343,10 @@ namespace boost {
                         std::string numerator = (std::string) std::string(integer_part).c_str() + (std::string) std::string(decimal_part);
                         if (!positive)
                             numerator = "-" + numerator;
-                        std::shared_ptr<real_data<T>> lhs = std::make_shared<real_data<T>>(real_explicit<T>(numerator));
-                        std::shared_ptr<real_data<T>> rhs = std::make_shared<real_data<T>>(real_explicit<T>(denominator));
+                        std::shared_ptr<real_data<T>> lhs = node_table<T>::make(real_explicit<T>(numerator));
+                        std::shared_ptr<real_data<T>> rhs = node_table<T>::make(real_explicit<T>(denominator));
         
-                        this->_real_p  = std::make_shared<real_data<T>>(real_operation(lhs, rhs, OPERATION::DIVISION));
+                        this->_real_p  = node_table<T>::make(real_operation(lhs, rhs, OPERATION::DIVISION));
                     }
                 }
                 if(type=="integer"){
@@ -141,7 +368,7 @@ namespace boost {
                         auto [integer_part, decimal_part, exponent, positive] = exact_number<>::number_from_string(number);
 
                         if ((int)(decimal_part.length() + integer_part.length()) <= exponent) {
-                            this->_real_p = std::make_shared<real_data<T>>(real_explicit<T>(integer_part, decimal_part, exponent, positive));
+                            this->_real_p = node_table<T>::make(real_explicit<T>(integer_part, decimal_part, exponent, positive));
                         } else {
                             int zeroes = decimal_part.length() + integer_part.length() - exponent;
                             std::string denominator = "1";
@@ -152,10 +379,10 @@ namespace boost {
                             std::string numerator = (std::string) std::string(integer_part).c_str() + (std::string) std::string(decimal_part);
                             if (!positive)
                                 numerator = "-" + numerator;
-                            std::shared_ptr<real_data<T>> lhs = std::make_shared<real_data<T>>(real_explicit<T>(numerator));
-                            std::shared_ptr<real_data<T>> rhs = std::make_shared<real_data<T>>(real_explicit<T>(denominator));
+                            std::shared_ptr<real_data<T>> lhs = node_table<T>::make(real_explicit<T>(numerator));
+                            std::shared_ptr<real_data<T>> rhs = node_table<T>::make(real_explicit<T>(denominator));
             
-                            this->_real_p  = std::make_shared<real_data<T>>(real_operation(lhs, rhs, OPERATION::DIVISION));
+                            this->_real_p  = node_table<T>::make(real_operation(lhs, rhs, OPERATION::DIVISION));
                         }
                         break;
                     }
@@ -182,7 +409,7 @@ namespace boost {
              * @param digits - a initializer_list<T> that represents the number digits.
              */
             real(std::initializer_list<T> digits)
-                    : _real_p(std::make_shared<real_data<T>>(real_explicit<T>(digits, digits.size())))
+                    : _real_p(node_table<T>::make(real_explicit<T>(digits, digits.size())))
                 {};
 
             /**
@@ -196,7 +423,7 @@ namespace boost {
              * the number is positive, otherwise is negative.
              */
             real(std::initializer_list<T> digits, bool positive)
-                    : _real_p(std::make_shared<real_data<T>>(real_explicit<T>(digits, digits.size(), positive)))
+                    : _real_p(node_table<T>::make(real_explicit<T>(digits, digits.size(), positive)))
                     {};
 
             /**
@@ -209,7 +436,7 @@ namespace boost {
              * @param exponent - an integer representing the number exponent.
              */
             real(std::initializer_list<T> digits, int exponent)
-                    : _real_p(std::make_shared<real_data<T>>(real_explicit<T>(digits, exponent)))
+                    : _real_p(node_table<T>::make(real_explicit<T>(digits, exponent)))
                     {};
 
             /**
@@ -224,7 +451,7 @@ namespace boost {
              * the number is positive, otherwise is negative.
              */
             real(std::initializer_list<T> digits, int exponent, bool positive)
-                    : _real_p(std::make_shared<real_data<T>>(real_explicit<T>(digits, exponent, positive)))
+                    : _real_p(node_table<T>::make(real_explicit<T>(digits, exponent, positive)))
                     {};
 
             /**
@@ -258,9 +485,10 @@ namespace boost {
                  : _real_p(::std::make_shared<real_data<T>>(real_algorithm<T>(get_nth_digit, exponent, positive))) {};
 
             // ctors from the 3 underlying types
-            real(real_explicit<T> x) : _real_p(std::make_shared<real_data<T>>(x)) {};
+            real(real_explicit<T> x) : _real_p(node_table<T>::make(x)) {};
             real(real_algorithm<T> x) : _real_p(std::make_shared<real_data<T>>(x)) {};
-            real(real_operation<T> x) : _real_p(std::make_shared<real_data<T>>(x)) {};
+            real(real_operation<T> x) : _real_p(node_table<T>::make(x)) {};
+            real(real_enclosure<T> x) : _real_p(std::make_shared<real_data<T>>(x)) {};
 
             /**
              * @brief Default destructor
@@ -290,6 +518,144 @@ namespace boost {
                 this->_real_p->get_precision_itr().set_maximum_precision(maximum_precision);
             }
 
+            /**
+             * @brief Refines the number own approximation interval to the next precision. The
+             * refinement is kept by the number, so it is reused by every later evaluation of it.
+             *
+             * @return false if the interval could not be refined, because it is a single number or
+             * its maximum precision was reached.
+             */
+            bool refine() const {
+                const_precision_iterator<T>& it = this->_real_p->get_precision_itr();
+                if (it.get_interval().is_a_number() || it.get_precision() >= it.maximum_precision()) {
+                    return false;
+                }
+                ++it;
+                return true;
+            }
+
+            /**
+             * @brief Returns an enclosure of the number in outward rounded double interval arithmetic.
+             * It is computed once and cached, the comparison operators use it as a filter before
+             * refining the numbers. Enclosures which can not be computed in doubles, e.g. of a division
+             * by an interval containing zero, are the entire real line.
+             */
+            double_interval double_enclosure() const {
+                return this->_real_p->double_enclosure();
+            }
+
+            /**
+             * @brief Returns an enclosure of the number in double-double interval arithmetic, about
+             * 100 bits wide for the basic operations. It is cached like the double enclosure, and used
+             * by the comparisons, sign() and approximate() before entering the exact engine. The
+             * precision iterators and operator<< do not use it and always evaluate the exact digits.
+             */
+            double_double_interval double_double_enclosure() const {
+                return this->_real_p->double_double_enclosure();
+            }
+
+            /**
+             * @brief Refines the number approximation interval until its width meets the requested
+             * tolerance, and no further. The first refinement jumps directly to the precision in bits
+             * that the current interval width suggests, the following ones are done one digit at a time.
+             *
+             * @param tolerance - a boost::real::real number greater than zero. Its approximation lower
+             * boundary is used as the target width, so the result is guaranteed for the exact tolerance.
+             * @param type - whether the tolerance is absolute or relative to the magnitude of *this.
+             * @return a boost::real::approximation with the enclosure meeting the tolerance and the
+             * precision used to obtain it. The precision is zero when the double-double enclosure
+             * already meets the tolerance.
+             *
+             * @throws boost::real::invalid_tolerance_exception if the tolerance is not greater than zero.
+             * @throws boost::real::precision_exception if the maximum precision is reached before the
+             * tolerance is met.
+             */
+            approximation<T> approximate(const real<T>& tolerance, TOLERANCE type = TOLERANCE::ABSOLUTE) const {
+                const_precision_iterator<T> tolerance_it = tolerance.get_real_itr();
+                while (!(literals::zero_exact<T> < tolerance_it.get_interval().lower_bound)) {
+                    if (tolerance_it.get_interval().upper_bound <= literals::zero_exact<T> ||
+                        tolerance_it.get_precision() >= tolerance_it.maximum_precision()) {
+                        throw invalid_tolerance_exception();
+                    }
+                    ++tolerance_it;
+                }
+                exact_number<T> eps = tolerance_it.get_interval().lower_bound;
+                eps.normalize();
+
+                auto target_width = [&eps, type] (interval<T> enclosure) {
+                    exact_number<T> target = eps;
+                    if (type == TOLERANCE::RELATIVE) {
+                        // the magnitude is bounded by the boundary closest to zero, an interval
+                        // containing zero can only meet a relative tolerance when it is exact.
+                        if (literals::zero_exact<T> < enclosure.lower_bound) {
+                            target = enclosure.lower_bound * eps;
+                        } else if (enclosure.upper_bound < literals::zero_exact<T>) {
+                            target = enclosure.upper_bound.abs() * eps;
+                        } else {
+                            target = literals::zero_exact<T>;
+                        }
+                        target.normalize();
+                    }
+                    return target;
+                };
+
+                // low accuracy requests are met by the double-double enclosure, without evaluating
+                // the number digits at all
+                // a boundary is only converted when it is zero or a finite double of moderate exponent,
+                // ilogb is not called on zero or non-finite values since it returns INT_MIN or INT_MAX there
+                auto convertible = [] (double x) {
+                    if (x == 0) {
+                        return true;
+                    }
+                    if (!std::isfinite(x)) {
+                        return false;
+                    }
+                    int exponent = std::ilogb(x);
+                    return -128 < exponent && exponent < 128;
+                };
+                const double_double_interval& fast = this->_real_p->double_double_enclosure();
+                if (!fast.is_entire() && convertible(fast.lower.hi) && convertible(fast.upper.hi)) {
+                    interval<T> enclosure {to_exact_number<T>(fast.lower), to_exact_number<T>(fast.upper)};
+                    if (enclosure.width() <= target_width(enclosure)) {
+                        return {enclosure, 0, 0};
+                    }
+                }
+
+                // the number own iterator is refined, so the work done here is reused afterwards
+                const_precision_iterator<T>& it = this->_real_p->get_precision_itr();
+                bool jumped = false;
+
+                while (true) {
+                    interval<T> enclosure = it.get_interval();
+                    exact_number<T> width = enclosure.width();
+                    exact_number<T> target = target_width(enclosure);
+
+                    if (width <= target) {
+                        return {enclosure, it.get_precision(), it.precision_bits()};
+                    }
+
+                    if (it.get_precision() >= it.maximum_precision()) {
+                        throw precision_exception();
+                    }
+
+                    // every bit shrinks the width by about a half, so the difference between the leading
+                    // bits of the width and the target tells how many bits are still missing. After that
+                    // jump, the refinement is done one digit at a time.
+                    int missing = 0;
+                    if (!jumped && target != literals::zero_exact<T>) {
+                        missing = width.leading_bit() - target.leading_bit() + 1;
+                    }
+
+                    if (missing > 0) {
+                        precision_t maximum_bits = it.maximum_precision() * exact_number<T>::BITS_PER_DIGIT;
+                        it.refine_to_bits(std::min(it.precision_bits() + missing, maximum_bits));
+                    } else {
+                        ++it;
+                    }
+                    jumped = true;
+                }
+            }
+
             /************** Operators ******************/
             
             /**
@@ -339,6 +705,11 @@ namespace boost {
                             std::cout << ' ';
                         std::cout << "alg\n";
                     },
+                    [space] (const real_enclosure<T>& real) {
+                        for (int i = PRINT_SPACE; i < space; i++)
+                            std::cout << ' ';
+                        std::cout << real.get_interval().as_string() << '\n';
+                    },
                     [&space] (const real_operation<T>& real) {
                         ((boost::real::real<T>) real.rhs()).print_tree(space + PRINT_SPACE);
                         std::cout << '\n';
@@ -370,245 +741,6 @@ namespace boost {
                 }, _real_p->get_real_number());
             }
 
-            // this is used to control the amount of recursion that goes on in the distribution. Essentially, when we do a + b, we may 
-            // look at one level below them (if applicable, i.e., they're operations pointing to operands of their own). 
-
-            // we at most need to look at two levels.
-            // this is because in the case we have, say, x*a+x*b -> (a+b)*x, we may want to look at a and b's operands, if applicable, to see if
-            // they may be distributed as well. 
-            enum class RECURSION_LEVEL{ZERO, ONE, TWO};
-
-            // a helper function for distributing when performing addition/subtraction 
-            // the returned bool tells us whether we distributed or not, which is mostly useful when assign_and_return_void is true
-            // since std::optional<real> would = std::null_opt if assign_and_return_void is false.
-            std::pair<bool, std::optional<real>> check_and_distribute(const real & other, const bool assign_and_return_void, const OPERATION op, const RECURSION_LEVEL rc_lvl) {
-                // The following simplifies using the distributive property, when numbers have the same pointers.
-                // We could do comparison by value, but this may force more computation than is necessary for the user,
-                // since it's difficult to determine whether values are the same
-
-                std::shared_ptr<real_data<T>> a;
-                std::shared_ptr<real_data<T>> b;
-                std::shared_ptr<real_data<T>> x;
-
-                if(auto op_ptr = std::get_if<real_operation<T>>(this->_real_p->get_real_ptr())) { // lhs real_operation
-                    if (auto op_ptr2 = std::get_if<real_operation<T>>(other._real_p->get_real_ptr())) { // lhs, rhs real_operation
-                        if ((op_ptr->get_operation() == OPERATION::MULTIPLICATION) && op_ptr2->get_operation() == OPERATION::MULTIPLICATION) {
-                            if (op_ptr->lhs() == op_ptr2->lhs()) { // x * a + x * b = (a + b) * x
-                                a = op_ptr->rhs();
-                                b = op_ptr2->rhs();
-                                x = op_ptr->lhs();
-
-                            } else if (op_ptr->lhs() == op_ptr2->rhs()) { // x * a + b * x = (a + b) * x
-                                a = op_ptr->rhs();
-                                b = op_ptr2->lhs();
-                                x = op_ptr->lhs();
-
-                            } else if (op_ptr->rhs() == op_ptr2->lhs()) { // a * x + x * b = (a + b) * x
-                                a = op_ptr->lhs();
-                                b = op_ptr2->rhs();
-                                x = op_ptr->rhs();
-
-                            } else if (op_ptr->rhs() == op_ptr2->rhs()) { // a * x + b * x = (a + b) * x
-                                a = op_ptr->lhs();
-                                b = op_ptr2->lhs();
-                                x = op_ptr->rhs();
-                            } else {
-                                return std::make_pair(false, std::nullopt);
-                            }
-
-                            real<T> a_op_b;
-
-                            if(op == OPERATION::ADDITION) {
-                                switch(rc_lvl) {
-                                    case (RECURSION_LEVEL::TWO):
-                                        a_op_b = real(a).add(real(b), RECURSION_LEVEL::ONE);
-                                        break;
-                                    case (RECURSION_LEVEL::ONE):
-                                        a_op_b = real(a).add(real(b), RECURSION_LEVEL::ZERO);
-                                        break;
-                                    default:
-                                        throw invalid_recursion_level_exception();
-                                }
-                            } else if (op == OPERATION::SUBTRACTION) {
-                                switch(rc_lvl) {
-                                    case (RECURSION_LEVEL::TWO):
-                                        a_op_b = real(a).subtract(real(b), RECURSION_LEVEL::ONE);
-                                        break;
-                                    case (RECURSION_LEVEL::ONE):
-                                        a_op_b = real(a).subtract(real(b), RECURSION_LEVEL::ZERO);
-                                        break;
-                                    default:
-                                        throw invalid_recursion_level_exception();
-                                }
-                            } else {
-                                throw invalid_distribution_operation_exception();
-                            }
-
-                            if(assign_and_return_void) {
-                                this->_real_p = std::make_shared<real_data<T>>(real_operation<T>(a_op_b._real_p, x, OPERATION::MULTIPLICATION));
-                                return std::make_pair(true, std::nullopt);
-                            } else {
-                                return std::make_pair(true, real(real_operation<T>(a_op_b._real_p, x, OPERATION::MULTIPLICATION)));
-                            }
-                        }
-                    } else { // lhs is an operation, but rhs is not an operation
-                        if (op_ptr->get_operation() == OPERATION::MULTIPLICATION) { 
-                            if (other._real_p == op_ptr->lhs()) { // (a * x) + a -> (x + 1) * a
-                                a = op_ptr->lhs();
-                                x = op_ptr->rhs();
-
-                            } else if (other._real_p == op_ptr->rhs()) {// (x * a) + a -> (x + 1) * a
-                                a = op_ptr->rhs();
-                                x = op_ptr->lhs();
-                            } else {
-                                return std::make_pair(false, std::nullopt);
-                            }
-
-                            real<T> one ("1");
-                            real<T> x_op_1;
-
-                            if(op == OPERATION::ADDITION) {
-                                switch(rc_lvl) {
-                                    case (RECURSION_LEVEL::TWO):
-                                        x_op_1 = real(x).add(real(one), RECURSION_LEVEL::ONE);
-                                        break;
-                                    case (RECURSION_LEVEL::ONE):
-                                        x_op_1 = real(a).add(real(one), RECURSION_LEVEL::ZERO);
-                                        break;
-                                    default:
-                                        throw invalid_recursion_level_exception();
-                                }
-                            }
-                            else if (op == OPERATION::SUBTRACTION) {
-                                switch(rc_lvl) {
-                                    case (RECURSION_LEVEL::TWO):
-                                        x_op_1 = real(a).subtract(real(b), RECURSION_LEVEL::ONE);
-                                        break;
-                                    case (RECURSION_LEVEL::ONE):
-                                        x_op_1 = real(a).subtract(real(b), RECURSION_LEVEL::ZERO);
-                                        break;
-                                    default:
-                                        throw invalid_recursion_level_exception();
-                                }
-                            } else {
-                                throw invalid_distribution_operation_exception();
-                            }
-
-                            if(assign_and_return_void) {
-                                this->_real_p = std::make_shared<real_data<T>>(real_operation<T>(x_op_1._real_p, a, OPERATION::MULTIPLICATION));
-                                return std::make_pair(true, std::nullopt);
-                            } else {
-                                return std::make_pair(true, real(real_operation<T>(x_op_1._real_p, a, OPERATION::MULTIPLICATION)));
-                            }
-                        } 
-                    }
-                } else if(auto op_ptr = std::get_if<real_operation<T>>(&other._real_p->get_real_number())) { // lhs is not an operation, but rhs is
-                    if (op_ptr->get_operation() == OPERATION::MULTIPLICATION) {
-                        if (this->_real_p == op_ptr->lhs()) { // a + (a * x) -> (x + 1) * a
-                            a = this->_real_p;
-                            x = op_ptr->rhs();
-
-                        } else if (this->_real_p == op_ptr->rhs()) {// a + (x * a) -> (x + 1) * a
-                            a = this->_real_p;
-                            x = op_ptr->lhs();
-                        } else {
-                            return std::make_pair(false, std::nullopt);
-                        }
-
-                        real<T> x_op_1;
-                        real<T> one ("1");
-
-                        if(op == OPERATION::ADDITION) {
-                            switch(rc_lvl) {
-                                case (RECURSION_LEVEL::TWO):
-                                    x_op_1 = real(x).add(real(one), RECURSION_LEVEL::ONE);
-                                    break;
-                                case (RECURSION_LEVEL::ONE):
-                                    x_op_1 = real(x).add(real(one), RECURSION_LEVEL::ZERO);
-                                    break;
-                                default:
-                                    throw invalid_recursion_level_exception();
-                            }
-                        }
-                        else if (op == OPERATION::SUBTRACTION) {
-                            switch(rc_lvl) {
-                                case (RECURSION_LEVEL::TWO):
-                                    x_op_1 = real(a).subtract(real(b), RECURSION_LEVEL::ONE);
-                                    break;
-                                case (RECURSION_LEVEL::ONE):
-                                    x_op_1 = real(a).subtract(real(b), RECURSION_LEVEL::ZERO);
-                                    break;
-                                default:
-                                    throw invalid_recursion_level_exception();
-                            }
-                        } else {
-                            throw invalid_distribution_operation_exception();
-                        }
-
-                        if(assign_and_return_void) {
-                            this->_real_p = std::make_shared<real_data<T>>(real_operation(x_op_1._real_p, a, OPERATION::MULTIPLICATION));
-                            return std::make_pair(true, std::nullopt);
-                        } else {
-                            return std::make_pair(true, real(real_operation(x_op_1._real_p, a, OPERATION::MULTIPLICATION)));
-                        }
-                    }
-                } else { // neither is an operation
-                    if ((this->_real_p == other._real_p) && (op == OPERATION::ADDITION)) { // a + a = 2 * a
-                        std::shared_ptr<real_data<T>> two = std::make_shared<real_data<T>>(real_explicit<T>("2"));
-
-                        if(assign_and_return_void) {
-                            this->_real_p = std::make_shared<real_data<T>>(real_operation(two, this->_real_p, OPERATION::MULTIPLICATION));
-                            return std::make_pair(true, std::nullopt);
-                        } else {
-                            return std::make_pair(true, real(real_operation(two, this->_real_p, OPERATION::MULTIPLICATION)));
-                        }
-                    } 
-                } 
-
-                // at this point, we cannot distribute.
-                return std::make_pair(false, std::nullopt);
-            }
-            
-
-            // helper function used in check_and_distribute to limit recursion
-            real recurse_op(real& other, RECURSION_LEVEL rc_lvl, OPERATION op) {
-                switch (rc_lvl) {
-                    case RECURSION_LEVEL::ONE: {
-                        auto [is_simplified, result] = check_and_distribute(other, false, op, RECURSION_LEVEL::ONE);
-
-                        if (!is_simplified) {
-                            real ret = (*this);
-                            ret._real_p = 
-                                std::make_shared<real_data<T>>(real_operation(this->_real_p, other._real_p, op));
-                            return ret;
-                        } else {
-                            return result.value();
-                        }
-                        return *this;
-                        break;
-                    }
-                    case RECURSION_LEVEL::ZERO: {
-                        real ret = (*this);
-                        ret._real_p = 
-                            std::make_shared<real_data<T>>(real_operation(this->_real_p, other._real_p, op));
-                        return ret;
-                        break;
-                    }
-                    default:
-                        throw invalid_recursion_level_exception();
-                }
-            }
-
-            /// obtains the result of *this += other, and returns it.
-            real add(real other, RECURSION_LEVEL rc_lvl) {
-                return recurse_op(other, rc_lvl, OPERATION::ADDITION);
-            }
-
-            /// performs *this -= other, and returns *this
-            real subtract(real other, RECURSION_LEVEL rc_lvl) {
-                return recurse_op(other, rc_lvl, OPERATION::SUBTRACTION);
-            }
-
             /**
              *      EXPONENT METHOD
              * @brief: Calculates e^real_num
@@ -754,6 +886,40 @@ namespace boost {
                 return real(real_operation<T>(real_num._real_p, zero._real_p, OPERATION::COSEC));
             }
 
+            /**
+             * @brief Returns the polynomial with the given coefficients at x, as a single POLYNOMIAL
+             * node. Its intervals are computed with the Horner scheme and the centered form on the
+             * interval of x, see boost::real::polynomial, so they do not suffer the dependency between
+             * the occurrences of x of a tree of additions and multiplications.
+             *
+             * @param coefficients - the coefficients, the one of x^k at index k.
+             * @param x - the polynomial argument.
+             */
+            static real polyval(const std::vector<real<T>>& coefficients, real<T> x) {
+                if (coefficients.empty()) {
+                    return real<T>("0");
+                }
+                std::vector<std::shared_ptr<real_data<T>>> nodes;
+                nodes.reserve(coefficients.size());
+                for (const real<T>& coefficient : coefficients) {
+                    nodes.push_back(coefficient._real_p);
+                }
+                return real(node_table<T>::make(real_operation<T>(x._real_p, std::move(nodes))));
+            }
+
+            /**
+             * @brief Returns the user defined function f at x, as a FUNCTION node. Its intervals are
+             * computed by the kernel of f on the intervals of x, using the monotonicity and the
+             * Lipschitz constant of f if they are given, see boost::real::real_function.
+             *
+             * @param f - the function, whose kernel must enclose its values on any interval.
+             * @param x - the function argument.
+             */
+            static real apply(real_function<T> f, real<T> x) {
+                auto function = std::make_shared<const real_function<T>>(std::move(f));
+                return real(node_table<T>::make(real_operation<T>(x._real_p, std::move(function))));
+            }
+
 
             /**
              * @brief Sets this real_data to that of the operation between this previous
@@ -765,77 +931,7 @@ namespace boost {
              */
 
             void operator += (real<T> other) {
-                std::visit( overloaded{ 
-                    [this] (real_rational<T> a, real_rational<T> b){
-                        this->_real_p = 
-                            std::make_shared<real_data<T>>(real_rational<T>(a+b));
-                    },
-
-                    [this, &other] (real_rational<T> rat, auto tmp){
-                        // converting rational number to explicit or operation
-                        real<T> rat_num;
-                        if(rat.b == literals::one_integer<T>){
-                            rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
-                        }
-                        else{
-                        
-                            // if rational number is of rational type, then it would be converted to a division operation between two integers
-                            real _a;
-                            _a._real_p =
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a)); 
-                            real _b;
-                            _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.b));
-                            rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
-                        }
-                        
-                        
-                        // now adding the numbers
-                        auto [is_simplified, result] = check_and_distribute(other, true, OPERATION::ADDITION, RECURSION_LEVEL::TWO);
-                        if(!is_simplified){
-                            this->_real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(rat_num._real_p, other._real_p, OPERATION::ADDITION));
-                        }
-                    },
-
-                    [this, &other] (auto tmp, real_rational<T> rat){
-                        real<T> rat_num;
-                        if(rat.b == literals::one_integer<T>){
-                            rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
-                        }
-                        else{
-                            real _a;
-                            _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
-                            real _b;
-                            _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.b));
-
-                            rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_operation(_a._real_p, _b._real_p, OPERATION::DIVISION));
-                        }
-
-                        // now adding the numbers
-                        auto [is_simplified, result] = check_and_distribute(other, true, OPERATION::ADDITION, RECURSION_LEVEL::TWO);
-                        if(!is_simplified){
-                            this->_real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(this->_real_p,rat_num._real_p, OPERATION::ADDITION));
-                        }
-
-                    },
-
-                    [this, &other] (auto a, auto b){
-                        auto [is_simplified,result] = check_and_distribute(other, true, OPERATION::ADDITION, RECURSION_LEVEL::TWO);
-                        
-                        if (!is_simplified) {
-                            this->_real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(this->_real_p, other._real_p, OPERATION::ADDITION));
-                        }
-                    }
-                }, _real_p->get_real_number(), other._real_p->get_real_number());
+                this->_real_p = arithmetic(OPERATION::ADDITION, *this, other)._real_p;
             }
 
             /**
@@ -846,80 +942,7 @@ namespace boost {
              * @return A copy of the new boost::real::real number representation.
              */
             real<T> operator + (real<T> other) {
-                real<T> result;
-                std::visit( overloaded{
-                    [&result] (real_rational<T> a, real_rational<T> b){
-                        result._real_p = 
-                            std::make_shared<real_data<T>>(real_rational<T>(a+b));
-                    },
-
-                    [this, &other, &result] (real_rational<T> rat, auto tmp){
-                        // converting rational number to explicit or operation type
-                        real<T> rat_num; //rational number
-
-                        // if number is of integer type, rat_num will be converted to explicit number
-                        if(rat.b == literals::one_integer<T>){
-                            rat_num._real_p =
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
-                        }
-                        else{
-                            real<T> _a, _b; // explicits numbers to represent numerator and denominator of rational number
-                            _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
-                            _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.b));
-
-                            rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
-                        }
-
-                        auto [is_simplified, result1] = rat_num.check_and_distribute(other, false, OPERATION::ADDITION, RECURSION_LEVEL::TWO);
-                        if (is_simplified)  {
-                            result = result1.value();
-                        } else {
-                            result = real<T>(real_operation<T>(rat_num._real_p, other._real_p, OPERATION::ADDITION));
-                        }
-                    },
-
-                    [this, &other, &result] (auto tmp, real_rational<T> rat){
-                        // converting rational number to explicit or operation type
-                        real<T> rat_num; //rational number
-
-                        // if number is of integer type, rat_num will be converted to explicit number
-                        if(rat.b == literals::one_integer<T>){
-                            rat_num._real_p =
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
-                        }
-                        else{
-                            real<T> _a, _b; // explicits numbers to represent numerator and denominator of rational number
-                            _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
-                            _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.b));
-
-                            rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
-                        }
-
-                        auto [is_simplified, result1] = rat_num.check_and_distribute(other, false, OPERATION::ADDITION, RECURSION_LEVEL::TWO);
-                        if (is_simplified)  {
-                            result = result1.value();
-                        } else {
-                            result = real<T>(real_operation<T>(this->_real_p, rat_num._real_p, OPERATION::ADDITION));
-                        }
-                    },
-
-                    [this, &other, &result] (auto a, auto b){
-                        auto [is_simplified, result1] = check_and_distribute(other, false, OPERATION::ADDITION, RECURSION_LEVEL::TWO);
-                        if (is_simplified)  {
-                            result = result1.value();
-                        } else {
-                            result = real<T>(real_operation<T>(this->_real_p, other._real_p, OPERATION::ADDITION));
-                        }
-                    }
-                }, _real_p->get_real_number(), other._real_p->get_real_number());
-                return result;
-                
+                return arithmetic(OPERATION::ADDITION, *this, other);
             }
 
             /**
@@ -929,78 +952,7 @@ namespace boost {
              * @param other - the right side operand boost::real::real number.
              */
             void operator -= (real<T> other) {
-                std::visit(overloaded{
-                    [this] (real_rational<T> a, real_rational<T> b){
-                        this->_real_p = 
-                            std::make_shared<real_data<T>>(real_rational<T>(a-b));
-                    },
-
-                    [this, &other] (real_rational<T> rat, auto tmp){
-                        // converting rational number to explicit or operation
-                        real<T> rat_num;
-                        if(rat.b == literals::one_integer<T>){
-                            rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
-                        }
-                        else{
-                        
-                            // if rational number is of rational type, then it would be converted to a division operation between two integers
-                            real _a;
-                            _a._real_p =
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a)); 
-                            real _b;
-                            _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.b));
-                            rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
-                        }
-                        
-                        
-                        // now adding the numbers
-                        auto [is_simplified, result] = check_and_distribute(other, true, OPERATION::SUBTRACTION, RECURSION_LEVEL::TWO);
-                        if(!is_simplified){
-                            this->_real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(rat_num._real_p, other._real_p, OPERATION::SUBTRACTION));
-                        }
-                    },
-
-                    [this, &other] (auto tmp, real_rational<T> rat){
-                        real<T> rat_num;
-                        if(rat.b == literals::one_integer<T>){
-                            rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
-                        }
-                        else{
-                            real _a;
-                            _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
-                            real _b;
-                            _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.b));
-
-                            rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_operation(_a._real_p, _b._real_p, OPERATION::DIVISION));
-                        }
-
-                        // now adding the numbers
-                        auto [is_simplified, result] = check_and_distribute(other, true, OPERATION::SUBTRACTION, RECURSION_LEVEL::TWO);
-                        if(!is_simplified){
-                            this->_real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(this->_real_p,rat_num._real_p, OPERATION::SUBTRACTION));
-                        }
-
-                    },
-
-                    [this, &other] (auto a, auto b){
-                        auto [is_simplified, result] = check_and_distribute(other, true, OPERATION::SUBTRACTION, RECURSION_LEVEL::TWO);
-
-                        if(!is_simplified) {
-                            this->_real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(this->_real_p, other._real_p, OPERATION::SUBTRACTION));
-                        }
-                    }
-                }, _real_p->get_real_number(), other._real_p->get_real_number());
-                
+                this->_real_p = arithmetic(OPERATION::SUBTRACTION, *this, other)._real_p;
             }
 
             /**
@@ -1011,79 +963,7 @@ namespace boost {
              * @return A copy of the new boost::real::real number representation.
              */
             real<T> operator - (real<T> other) {
-                real<T> result;
-                std::visit( overloaded{
-                    [&result] (real_rational<T> a, real_rational<T> b){
-                        result._real_p = 
-                            std::make_shared<real_data<T>>(real_rational<T>(a-b));
-                    },
-
-                    [this, &other, &result] (real_rational<T> rat, auto tmp){
-                        // converting rational number to explicit or operation type
-                        real<T> rat_num; //rational number
-
-                        // if number is of integer type, rat_num will be converted to explicit number
-                        if(rat.b == literals::one_integer<T>){
-                            rat_num._real_p =
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
-                        }
-                        else{
-                            real<T> _a, _b; // explicits numbers to represent numerator and denominator of rational number
-                            _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
-                            _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.b));
-
-                            rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
-                        }
-
-                        auto [is_simplified, result1] = rat_num.check_and_distribute(other, false, OPERATION::SUBTRACTION, RECURSION_LEVEL::TWO);
-                        if (is_simplified)  {
-                            result = result1.value();
-                        } else {
-                            result = real<T>(real_operation<T>(rat_num._real_p, other._real_p, OPERATION::SUBTRACTION));
-                        }
-                    },
-
-                    [this, &other, &result] (auto tmp, real_rational<T> rat){
-                        // converting rational number to explicit or operation type
-                        real<T> rat_num; //rational number
-
-                        // if number is of integer type, rat_num will be converted to explicit number
-                        if(rat.b == literals::one_integer<T>){
-                            rat_num._real_p =
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
-                        }
-                        else{
-                            real<T> _a, _b; // explicits numbers to represent numerator and denominator of rational number
-                            _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
-                            _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.b));
-
-                            rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
-                        }
-
-                        auto [is_simplified, result1] = rat_num.check_and_distribute(other, false, OPERATION::SUBTRACTION, RECURSION_LEVEL::TWO);
-                        if (is_simplified)  {
-                            result = result1.value();
-                        } else {
-                            result = real<T>(real_operation<T>(this->_real_p, rat_num._real_p, OPERATION::SUBTRACTION));
-                        }
-                    },
-
-                    [this, &other, &result] (auto a, auto b){
-                        auto [is_simplified, result1] = check_and_distribute(other, false, OPERATION::SUBTRACTION, RECURSION_LEVEL::TWO);
-                        if (is_simplified)  {
-                            result = result1.value();
-                        } else {
-                            result = real(real_operation<T>(this->_real_p, other._real_p, OPERATION::SUBTRACTION));
-                        }
-                    }
-                }, _real_p->get_real_number(), other._real_p->get_real_number());
-                return result;
+                return arithmetic(OPERATION::SUBTRACTION, *this, other);
             }
 
             /**
@@ -1093,70 +973,7 @@ namespace boost {
              * @param other - the right side operand boost::real::real number.
              */
             void operator*=(real<T> other) {
-                std::visit(overloaded{
-                    [this] (real_rational<T> a, real_rational<T> b){
-                        this->_real_p = 
-                            std::make_shared<real_data<T>>(real_rational<T>(a*b));
-                    },
-
-                    [this, &other] (real_rational<T> rat, auto tmp){
-                        // converting rational number to explicit or operation
-                        real<T> rat_num;
-                        if(rat.b == literals::one_integer<T>){
-                            rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
-                        }
-                        else{
-                        
-                            // if rational number is of rational type, then it would be converted to a division operation between two integers
-                            real _a;
-                            _a._real_p =
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a)); 
-                            real _b;
-                            _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.b));
-                            rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
-                        }
-                        
-                        
-                        // now adding the numbers
-                        this->_real_p = 
-                            std::make_shared<real_data<T>>(real_operation<T>(rat_num._real_p, other._real_p, OPERATION::MULTIPLICATION));
-                    },
-
-                    [this, &other] (auto tmp, real_rational<T> rat){
-                        real<T> rat_num;
-                        if(rat.b == literals::one_integer<T>){
-                            rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
-                        }
-                        else{
-                            real _a;
-                            _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
-                            real _b;
-                            _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.b));
-
-                            rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_operation(_a._real_p, _b._real_p, OPERATION::DIVISION));
-                        }
-
-                        // now adding the numbers
-                        
-                        this->_real_p = 
-                            std::make_shared<real_data<T>>(real_operation<T>(this->_real_p,rat_num._real_p, OPERATION::MULTIPLICATION));
-
-                    },
-
-
-                    [this, &other] (auto a, auto b){
-                        this->_real_p =
-                        std::make_shared<real_data<T>>(real_operation<T>(this->_real_p, other._real_p, OPERATION::MULTIPLICATION));
-                    }
-                }, _real_p->get_real_number(), other._real_p->get_real_number());
-                
+                this->_real_p = arithmetic(OPERATION::MULTIPLICATION, *this, other)._real_p;
             }
 
             /**
@@ -1167,68 +984,7 @@ namespace boost {
              * @return A copy of the new boost::real::real number representation.
              */
             real<T> operator * (real<T> other) {
-                real<T> result;
-                std::visit(overloaded{
-                    [&result] (real_rational<T> a, real_rational<T> b){
-                        result._real_p = 
-                            std::make_shared<real_data<T>>(real_rational<T>(a*b));
-                    },
-
-                    [this, &other, &result] (real_rational<T> rat, auto tmp){
-                        // converting rational number to explicit or operation type
-                        real<T> rat_num; //rational number
-
-                        // if number is of integer type, rat_num will be converted to explicit number
-                        if(rat.b == literals::one_integer<T>){
-                            rat_num._real_p =
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
-                        }
-                        else{
-                            real<T> _a, _b; // explicits numbers to represent numerator and denominator of rational number
-                            _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
-                            _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.b));
-
-                            rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
-                        }
-
-                        
-                        result = real<T>(real_operation<T>(rat_num._real_p, other._real_p, OPERATION::MULTIPLICATION));
-                        
-                    },
-
-                    [this, &other, &result] (auto tmp, real_rational<T> rat){
-                        // converting rational number to explicit or operation type
-                        real<T> rat_num; //rational number
-
-                        // if number is of integer type, rat_num will be converted to explicit number
-                        if(rat.b == literals::one_integer<T>){
-                            rat_num._real_p =
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
-                        }
-                        else{
-                            real<T> _a, _b; // explicits numbers to represent numerator and denominator of rational number
-                            _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
-                            _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.b));
-
-                            rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
-                        }
-
-                        
-                        result = real<T>(real_operation<T>(this->_real_p, rat_num._real_p, OPERATION::MULTIPLICATION));
-                        
-                    },
-
-                    [this, &other, &result] (auto a, auto b){
-                        result = real(real_operation<T>(this->_real_p, other._real_p, OPERATION::MULTIPLICATION));
-                    }
-                }, _real_p->get_real_number(), other.get_real_number());
-                return result;
+                return arithmetic(OPERATION::MULTIPLICATION, *this, other);
             }
 
             /**
@@ -1239,69 +995,7 @@ namespace boost {
              * @return A copy of the new boost::real::real number representation.
              */
             real<T> operator / (real<T> other) {
-                real<T> result;
-                std::visit(overloaded{
-                    [&result] (real_rational<T> a, real_rational<T> b){
-                        real_rational<T> result1 = a/b;
-                        result._real_p = 
-                            std::make_shared<real_data<T>>(real_rational(result1));
-                    },
-
-                    [this, &other, &result] (real_rational<T> rat, auto tmp){
-                        // converting rational number to explicit or operation type
-                        real<T> rat_num; //rational number
-
-                        // if number is of integer type, rat_num will be converted to explicit number
-                        if(rat.b == literals::one_integer<T>){
-                            rat_num._real_p =
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
-                        }
-                        else{
-                            real<T> _a, _b; // explicits numbers to represent numerator and denominator of rational number
-                            _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
-                            _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.b));
-
-                            rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
-                        }
-
-                        
-                        result = real<T>(real_operation<T>(rat_num._real_p, other._real_p, OPERATION::DIVISION));
-                        
-                    },
-
-                    [this, &other, &result] (auto tmp, real_rational<T> rat){
-                        // converting rational number to explicit or operation type
-                        real<T> rat_num; //rational number
-
-                        // if number is of integer type, rat_num will be converted to explicit number
-                        if(rat.b == literals::one_integer<T>){
-                            rat_num._real_p =
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
-                        }
-                        else{
-                            real<T> _a, _b; // explicits numbers to represent numerator and denominator of rational number
-                            _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
-                            _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.b));
-
-                            rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
-                        }
-
-                        
-                        result = real<T>(real_operation<T>(this->_real_p, rat_num._real_p, OPERATION::DIVISION));
-                        
-                    },
-
-                    [this, &other, &result] (auto a, auto b){
-                        result = real(real_operation<T>(this->_real_p, other._real_p, OPERATION::DIVISION));
-                    }
-                }, _real_p->get_real_number(), other._real_p->get_real_number());
-                return result;
+                return arithmetic(OPERATION::DIVISION, *this, other);
             }
 
             /**
@@ -1311,69 +1005,7 @@ namespace boost {
              * @param other - the right side operand boost::real::real number.
              */
             void operator /= (real<T> other) {
-                std::visit(overloaded{
-                    [this] (real_rational<T> a, real_rational<T> b){
-                        this->_real_p = 
-                            std::make_shared<real_data<T>>(real_rational<T>(a/b));
-                    },
-
-                    [this, &other] (real_rational<T> rat, auto tmp){
-                        // converting rational number to explicit or operation
-                        real<T> rat_num;
-                        if(rat.b == literals::one_integer<T>){
-                            rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
-                        }
-                        else{
-                        
-                            // if rational number is of rational type, then it would be converted to a division operation between two integers
-                            real _a;
-                            _a._real_p =
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a)); 
-                            real _b;
-                            _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.b));
-                            rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
-                        }
-                        
-                        
-                        // now adding the numbers
-                        this->_real_p = 
-                            std::make_shared<real_data<T>>(real_operation<T>(rat_num._real_p, other._real_p, OPERATION::DIVISION));
-                    },
-
-                    [this, &other] (auto tmp, real_rational<T> rat){
-                        real<T> rat_num;
-                        if(rat.b==literals::one_integer<T>){
-                            rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
-                        }
-                        else{
-                            real _a;
-                            _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.a));
-                            real _b;
-                            _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat.b));
-
-                            rat_num._real_p = 
-                                std::make_shared<real_data<T>>(real_operation(_a._real_p, _b._real_p, OPERATION::DIVISION));
-                        }
-
-                        // now adding the numbers
-                        
-                        this->_real_p = 
-                            std::make_shared<real_data<T>>(real_operation<T>(this->_real_p,rat_num._real_p, OPERATION::DIVISION));
-
-                    },
-
-                    [this, &other] (auto a, auto b){
-                        this->_real_p =
-                            std::make_shared<real_data<T>>(real_operation<T>(this->_real_p, other._real_p, OPERATION::DIVISION));
-                    }
-                }, _real_p->get_real_number(), other._real_p->get_real_number());
-                
+                this->_real_p = arithmetic(OPERATION::DIVISION, *this, other)._real_p;
             }
 
             /**
@@ -1390,190 +1022,222 @@ namespace boost {
              */
             void operator=(const std::string& number) {
                 this->_real_p =
-                    std::make_shared<real_data<T>>(real_explicit<T>(number));
+                    node_table<T>::make(real_explicit<T>(number));
             }
 
             /**
-             * @brief Compares the *this boost::real::real number against the other boost::real::real number to
-             * determine if the number represented by *this is lower than the number represented by other.
-             * If the maximum precision is reached and the operator was not yet able to determine
-             * the value of the result, a precision_exception is thrown.
+             * @brief Compares *this against other without throwing when the order can not be
+             * decided. The floating-point enclosures are compared first, then the numbers own
+             * iterators are refined together, from where earlier evaluations left them, until the
+             * approximation intervals stop overlapping, both become a single number, or the policy
+             * maximum precision is reached.
              *
              * @param other - a boost::real::real number to compare against.
-             * @return a bool that is true if *this < other and false in other cases.
-             *
-             * @throws boost::real::precision_exception
+             * @param policy - the boost::real::precision_policy limiting the refinement.
+             * @return a boost::real::comparison with the order of *this with respect to other and
+             * the precision reached. The order is UNDECIDED if the intervals still overlap at the
+             * maximum precision.
              */
-            bool operator<(const real<T>& other) const {
-                bool ret;
-                std::visit(overloaded{
-                    [&ret] (real_rational<T> a, real_rational<T> b){
-                        ret = (a<b);
-                    },
-
-                    [this, &other, &ret] (real_rational<T> rat_num, auto tmp){
-                        real<T> _this;
-                        if(rat_num.b == literals::one_integer<T>)
-                            _this._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
-                        else {
-                            real _a, _b; // to represent "a" and "b" in rational number a/b
-                            _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
-
-                            _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.b));
-
-                            _this._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
-
-                        }
-
-
-                        // now comparing numbers
-                        auto this_it = _this._real_p->get_precision_itr().cbegin();
-                        auto other_it = other._real_p->get_precision_itr().cbegin();
-
-                        if(this_it == other_it)
-                        {
-                            ret = false;
-                            return;
-                        }
-
-                        unsigned int current_precision = std::max(_this.maximum_precision(), other.maximum_precision());
-                        unsigned int p;
-                        for (p = 0; p < current_precision; ++p){
-                            // Get more precision
-                            ++this_it;
-                            ++other_it;
-
-                            bool this_full_precision = this_it.get_interval().is_a_number();
-                            bool other_full_precision = other_it.get_interval().is_a_number();
-                            if (this_full_precision && other_full_precision){
-                                ret = this_it.get_interval() < other_it.get_interval();
-                                break;
-                            }
-
-                            if (this_it.get_interval()< other_it.get_interval()) {
-                                ret = true;
-                                break;
-                            }
-
-                            if (other_it.get_interval()< this_it.get_interval()) {
-                                ret = false;
-                                break;
-                            }
-                        }
-
-                        // If the precision is reached and the number ranges still overlap, then we cannot
-                        // know if they are equals or other is less than this and we throw an error.
-                        if(p == current_precision)
-                            throw boost::real::precision_exception();
-                    },
-
-                    [this, &ret] (auto tmp, real_rational<T> rat_num){
-                        real<T> other; // representing "other" number, which is a rational number
-                        if(rat_num.b == literals::one_integer<T>)   
-                            other._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
-                        else {
-                            real _a, _b; // to represent "a" and "b" in rational number a/b
-                            _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
+            comparison compare(const real<T>& other, precision_policy policy = {}) const {
+                if (this->_real_p == other._real_p) {
+                    return {ORDER::EQUAL, 0};
+                }
 
-                            _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.b));
+                // floating-point filter, the exact engine is only entered if the enclosures overlap
+                const double_interval& this_enclosure = this->_real_p->double_enclosure();
+                const double_interval& other_enclosure = other._real_p->double_enclosure();
+                if (this_enclosure < other_enclosure) {
+                    return {ORDER::LESS, 0};
+                }
+                if (this_enclosure > other_enclosure) {
+                    return {ORDER::GREATER, 0};
+                }
+                int order = double_double_order(other);
+                if (order != 0) {
+                    return {order < 0 ? ORDER::LESS : ORDER::GREATER, 0};
+                }
 
-                            other._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
+                const real_number<T>& this_number = this->_real_p->get_real_number();
+                const real_number<T>& other_number = other._real_p->get_real_number();
+                if (std::holds_alternative<real_rational<T>>(this_number) &&
+                    std::holds_alternative<real_rational<T>>(other_number)) {
+                    const real_rational<T>& a = std::get<real_rational<T>>(this_number);
+                    const real_rational<T>& b = std::get<real_rational<T>>(other_number);
+                    if (a < b) {
+                        return {ORDER::LESS, 0};
+                    }
+                    if (a > b) {
+                        return {ORDER::GREATER, 0};
+                    }
+                    return {ORDER::EQUAL, 0};
+                }
 
-                        }
+                // rational numbers are compared through their real_operation equivalent
+                real<T> this_real = *this;
+                real<T> other_real = other;
+                if (std::holds_alternative<real_rational<T>>(this_number)) {
+                    this_real = from_rational(std::get<real_rational<T>>(this_number));
+                }
+                if (std::holds_alternative<real_rational<T>>(other_number)) {
+                    other_real = from_rational(std::get<real_rational<T>>(other_number));
+                }
 
+                // the numbers own iterators are refined, so the work done here is reused afterwards
+                const_precision_iterator<T>& this_it = this_real._real_p->get_precision_itr();
+                const_precision_iterator<T>& other_it = other_real._real_p->get_precision_itr();
 
-                        // now comparing numbers
-                        auto this_it = this->_real_p->get_precision_itr().cbegin();
-                        auto other_it = other._real_p->get_precision_itr().cbegin();
+                precision_t maximum_precision = policy.maximum_precision;
+                if (maximum_precision == 0) {
+                    maximum_precision = std::max(this_real.maximum_precision(), other_real.maximum_precision());
+                }
 
-                        if(this_it == other_it)
-                        {
-                            ret = false;
-                            return;
-                        }
+                while (true) {
+                    precision_t precision = std::max(this_it.get_precision(), other_it.get_precision());
 
-                        unsigned int current_precision = std::max(this->maximum_precision(), other.maximum_precision());
-                        unsigned int p;
-                        for (p = 0; p < current_precision; ++p){
-                            // Get more precision
-                            ++this_it;
-                            ++other_it;
-
-                            bool this_full_precision = this_it.get_interval().is_a_number();
-                            bool other_full_precision = other_it.get_interval().is_a_number();
-                            if (this_full_precision && other_full_precision){
-                                ret = this_it.get_interval() < other_it.get_interval();
-                                break;
-                            }
+                    if (this_it.get_interval() < other_it.get_interval()) {
+                        return {ORDER::LESS, precision};
+                    }
+                    if (this_it.get_interval() > other_it.get_interval()) {
+                        return {ORDER::GREATER, precision};
+                    }
+                    if (this_it.get_interval().is_a_number() && other_it.get_interval().is_a_number()) {
+                        // overlapping single numbers are the same number
+                        return {ORDER::EQUAL, precision};
+                    }
 
-                            if (this_it.get_interval()< other_it.get_interval()) {
-                                ret = true;
-                                break;
-                            }
+                    // like sign(), the maximum precision is the last one evaluated
+                    bool this_refinable = !this_it.get_interval().is_a_number() && this_it.get_precision() < maximum_precision;
+                    bool other_refinable = !other_it.get_interval().is_a_number() && other_it.get_precision() < maximum_precision;
+                    if (!this_refinable && !other_refinable) {
+                        break;
+                    }
+                    if (this_refinable) {
+                        ++this_it;
+                    }
+                    if (other_refinable) {
+                        ++other_it;
+                    }
+                }
+                return {ORDER::UNDECIDED, std::max(this_it.get_precision(), other_it.get_precision())};
+            }
 
-                            if (other_it.get_interval()< this_it.get_interval()) {
-                                ret = false;
-                                break;
-                            }
-                        }
+            /**
+             * @brief Determines the sign of the number, refining only this number: the sign is
+             * taken from the number structure if possible, then from its floating-point enclosures,
+             * and last from its own approximation interval, refined until it excludes zero. Unlike a
+             * comparison against a zero real, no second number is refined and no exception is thrown
+             * when the budget is not enough.
+             *
+             * @param policy - the boost::real::precision_policy limiting the refinement.
+             * @return a boost::real::comparison of the number with zero: GREATER for a positive
+             * number, LESS for a negative one, EQUAL for zero and UNDECIDED if the interval still
+             * contains zero at the maximum precision, together with the precision reached.
+             */
+            comparison sign(precision_policy policy = {}) const {
+                std::optional<ORDER> known = structural_sign(this->_real_p);
+                if (known) {
+                    return {*known, 0};
+                }
 
-                        // If the precision is reached and the number ranges still overlap, then we cannot
-                        // know if they are equals or other is less than this and we throw an error.
-                        if(p == current_precision)
-                            throw boost::real::precision_exception();
-                    },
+                const double_interval& fast = this->_real_p->double_enclosure();
+                if (fast.positive() || fast.negative()) {
+                    return {fast.positive() ? ORDER::GREATER : ORDER::LESS, 0};
+                }
+                const double_double_interval& fast_dd = this->_real_p->double_double_enclosure();
+                if (fast_dd.positive() || fast_dd.negative()) {
+                    return {fast_dd.positive() ? ORDER::GREATER : ORDER::LESS, 0};
+                }
 
-                    [this, &other, &ret] (auto a, auto b){
-                        auto this_it = this->_real_p->get_precision_itr().cbegin();
-                        auto other_it = other._real_p->get_precision_itr().cbegin();
+                // the number own iterator is refined, so the work done here is reused afterwards
+                const_precision_iterator<T>& it = this->_real_p->get_precision_itr();
+                precision_t maximum_precision = policy.maximum_precision == 0 ? it.maximum_precision() : policy.maximum_precision;
+                while (true) {
+                    const interval<T>& enclosure = it.get_interval();
+                    if (literals::zero_exact<T> < enclosure.lower_bound) {
+                        return {ORDER::GREATER, it.get_precision()};
+                    }
+                    if (enclosure.upper_bound < literals::zero_exact<T>) {
+                        return {ORDER::LESS, it.get_precision()};
+                    }
+                    if (enclosure.is_a_number()) {
+                        return {ORDER::EQUAL, it.get_precision()};
+                    }
+                    if (it.get_precision() >= maximum_precision) {
+                        return {ORDER::UNDECIDED, it.get_precision()};
+                    }
+                    ++it;
+                }
+            }
 
-                        if (this_it == other_it)
-                        {
-                            ret = false;
-                            return;
-                        }
+            /**
+             * @brief Determines if the number is zero. Numbers which are zero, or not, by their
+             * structure are detected without evaluating them, the others use sign().
+             *
+             * @return a bool that is true if and only if the number is zero.
+             *
+             * @throws boost::real::precision_exception if the approximation interval still contains
+             * zero at the maximum precision.
+             */
+            bool is_zero() const {
+                ORDER order = sign().order;
+                if (order == ORDER::UNDECIDED) {
+                    throw boost::real::precision_exception();
+                }
+                return order == ORDER::EQUAL;
+            }
 
-                        unsigned int current_precision = std::max(this->maximum_precision(), other.maximum_precision());
-                        unsigned int p;
-                        for (p = 0; p < current_precision; ++p) {
-                            // Get more precision
-                            ++this_it;
-                            ++other_it;
-
-                            bool this_full_precision = this_it.get_interval().is_a_number();
-                            bool other_full_precision = other_it.get_interval().is_a_number();
-                            if (this_full_precision && other_full_precision) {
-                                ret = this_it.get_interval() < other_it.get_interval();
-                                break;
-                            }
+            /**
+             * @brief Replaces the operation tree of the number by a leaf holding its approximation
+             * interval at the given precision, or by an explicit leaf if that interval is a single
+             * number, so the tree can be freed. The number can not be refined beyond that precision
+             * afterwards. Other numbers sharing the tree are not modified. Explicit, rational and
+             * algorithmic numbers are kept as they are.
+             *
+             * @param precision - the precision to evaluate the number to, its maximum precision if zero.
+             */
+            void materialize(precision_t precision = 0) {
+                this->_real_p = node_table<T>::materialize(this->_real_p, precision);
+            }
 
-                            if (this_it.get_interval()< other_it.get_interval()) {
-                                ret = true;
-                                break;
-                            }
+            /// the depth of the operation tree of the number, one for leaves
+            size_t depth() const {
+                return this->_real_p->depth();
+            }
 
-                            if (other_it.get_interval()< this_it.get_interval()) {
-                                ret = false;
-                                break;
-                            }
-                        }
+            /**
+             * @brief Returns an equivalent number whose operation tree is rewritten by algebraic
+             * rules: identity elements are removed (x + 0, x * 1, x / 1), x - x is replaced by zero,
+             * the constant parts of sums and products are computed exactly, repeated terms are
+             * combined (x + x = 2 * x), common factors are extracted (x * a + x * b = (a + b) * x)
+             * and long chains of sums and products are rebalanced. Equal subtrees are shared.
+             *
+             * The rewrite is opt-in, the operators build the tree as written. The number is not
+             * modified, and the subtrees that are kept keep their approximations.
+             *
+             * @return a boost::real::real number with the same value.
+             */
+            real<T> simplify() const {
+                simplifier<T> rewrite;
+                return real<T>(rewrite.simplify(this->_real_p));
+            }
 
-                        // If the precision is reached and the number ranges still overlap, then we cannot
-                        // know if they are equals or other is less than this and we throw an error.
-                        if(p == current_precision)
-                            throw boost::real::precision_exception();
-                    }
-                }, _real_p->get_real_number(), other._real_p->get_real_number());
-                return ret;
-                
+            /**
+             * @brief Compares the *this boost::real::real number against the other boost::real::real number to
+             * determine if the number represented by *this is lower than the number represented by other.
+             * If the maximum precision is reached and the operator was not yet able to determine
+             * the value of the result, a precision_exception is thrown.
+             *
+             * @param other - a boost::real::real number to compare against.
+             * @return a bool that is true if *this < other and false in other cases.
+             *
+             * @throws boost::real::precision_exception
+             */
+            bool operator<(const real<T>& other) const {
+                ORDER order = compare(other).order;
+                if (order == ORDER::UNDECIDED) {
+                    throw boost::real::precision_exception();
+                }
+                return order == ORDER::LESS;
             }
 
             /**
@@ -1588,158 +1252,11 @@ namespace boost {
              * @throws boost::real::precision_exception
              */
             bool operator>(const real<T>& other) const {
-                bool ret;
-                std::visit(overloaded{
-                    [&ret] (real_rational<T> a, real_rational<T> b){
-                        ret = (a>b);
-                    },
-
-                    [&other, &ret] (real_rational<T> rat_num, auto tmp){
-                        real<T> _this; // representing "other" number, which is a rational number
-                        if(rat_num.b == literals::one_integer<T>)   
-                            _this._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
-                        else {
-                            real _a, _b; // to represent "a" and "b" in rational number a/b
-                            _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
-
-                            _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.b));
-
-                            _this._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
-
-                        }
-
-                        auto this_it = _this._real_p->get_precision_itr().cbegin();
-                        auto other_it = other._real_p->get_precision_itr().cbegin();
-
-                        if (this_it == other_it){
-                            ret = false;
-                            return;
-                        }
-
-                        unsigned int current_precision = std::max(_this.maximum_precision(), other.maximum_precision());
-                        unsigned int p;
-                        for (p=0; p < current_precision; ++p) {
-                            // Get more precision
-                            ++this_it;
-                            ++other_it;
-                            bool this_full_precision = this_it.get_interval().is_a_number();
-                            bool other_full_precision = other_it.get_interval().is_a_number();
-                            if (this_full_precision && other_full_precision) {
-                                ret = this_it.get_interval() > other_it.get_interval();
-                                break;
-                            }
-                            if (this_it.get_interval()> other_it.get_interval()) {
-                                ret = true;
-                                break;
-                            }
-                            if (other_it.get_interval()> this_it.get_interval()) {
-                                ret = false;
-                                break;
-                            }
-                        }
-                        // If the precision is reached and the number ranges still overlap, then we cannot
-                        // know if they are equals or other is less than this and we throw an error.
-                        if(p == current_precision)
-                            throw boost::real::precision_exception();
-
-
-                    },
-
-                    [this, &ret] (auto tmp, real_rational<T> rat_num){
-
-                        real<T> other; // representing "other" number, which is a rational number
-                        if(rat_num.b == literals::one_integer<T>)   
-                            other._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
-                        else {
-                            real _a, _b; // to represent "a" and "b" in rational number a/b
-                            _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
-
-                            _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.b));
-
-                            other._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
-
-                        }
-
-                        auto this_it = this->_real_p->get_precision_itr().cbegin();
-                        auto other_it = other._real_p->get_precision_itr().cbegin();
-
-                        if (this_it == other_it){
-                            ret = false;
-                            return;
-                        }
-
-                        unsigned int current_precision = std::max(this->maximum_precision(), other.maximum_precision());
-                        unsigned int p;
-                        for (p=0; p < current_precision; ++p) {
-                            // Get more precision
-                            ++this_it;
-                            ++other_it;
-                            bool this_full_precision = this_it.get_interval().is_a_number();
-                            bool other_full_precision = other_it.get_interval().is_a_number();
-                            if (this_full_precision && other_full_precision) {
-                                ret = this_it.get_interval() > other_it.get_interval();
-                                break;
-                            }
-                            if (this_it.get_interval()> other_it.get_interval()) {
-                                ret = true;
-                                break;
-                            }
-                            if (other_it.get_interval()> this_it.get_interval()) {
-                                ret = false;
-                                break;
-                            }
-                        }
-                        // If the precision is reached and the number ranges still overlap, then we cannot
-                        // know if they are equals or other is less than this and we throw an error.
-                        if(p == current_precision)
-                            throw boost::real::precision_exception();
-                    },
-
-                    [this, &other, &ret] (auto a, auto b){
-                        auto this_it = this->_real_p->get_precision_itr().cbegin();
-                        auto other_it = other._real_p->get_precision_itr().cbegin();
-
-                        if (this_it == other_it){
-                            ret = false;
-                            return;
-                        }
-
-                        unsigned int current_precision = std::max(this->maximum_precision(), other.maximum_precision());
-                        unsigned int p;
-                        for (p=0; p < current_precision; ++p) {
-                            // Get more precision
-                            ++this_it;
-                            ++other_it;
-                            bool this_full_precision = this_it.get_interval().is_a_number();
-                            bool other_full_precision = other_it.get_interval().is_a_number();
-                            if (this_full_precision && other_full_precision) {
-                                ret = this_it.get_interval() > other_it.get_interval();
-                                break;
-                            }
-                            if (this_it.get_interval()> other_it.get_interval()) {
-                                ret = true;
-                                break;
-                            }
-                            if (other_it.get_interval()> this_it.get_interval()) {
-                                ret = false;
-                                break;
-                            }
-                        }
-                        // If the precision is reached and the number ranges still overlap, then we cannot
-                        // know if they are equals or other is less than this and we throw an error.
-                        if(p == current_precision)
-                            throw boost::real::precision_exception();
-                    }
-                }, _real_p->get_real_number(), other._real_p->get_real_number());
-                return ret;
+                ORDER order = compare(other).order;
+                if (order == ORDER::UNDECIDED) {
+                    throw boost::real::precision_exception();
+                }
+                return order == ORDER::GREATER;
             }
 
             /**
@@ -1749,153 +1266,16 @@ namespace boost {
              * the value of the result, a precision_exception is thrown.
              *
              * @param other - a boost::real::real number to compare against.
-             * @return a bool that is true if *this < other and false in other cases.
+             * @return a bool that is true if *this == other and false in other cases.
              *
              * @throws boost::real::precision_exception
              */
             bool operator == (const real<T>& other) const {
-                bool ret;
-                std::visit(overloaded{
-                    [&ret] (real_rational<T> a, real_rational<T> b){
-                        ret = (a==b);
-                    },
-
-                    [&other, &ret] (real_rational<T> rat_num, auto tmp){
-                        real<T> _this; // representing "other" number, which is a rational number
-                        if(rat_num.b==literals::one_integer<T>)   
-                            _this._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
-                        else {
-                            real _a, _b; // to represent "a" and "b" in rational number a/b
-                            _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
-
-                            _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.b));
-
-                            _this._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
-
-                        }
-
-                        auto this_it = _this._real_p->get_precision_itr().cbegin();
-                        auto other_it = other._real_p->get_precision_itr().cbegin();
-
-                        unsigned int current_precision = std::max(_this.maximum_precision(), other.maximum_precision());
-                        unsigned int p;
-                        for (p = 0; p < current_precision; ++p) {
-                            // Get more precision
-                            ++this_it;
-                            ++other_it;
-
-                            bool this_full_precision = this_it.get_interval().is_a_number();
-                            bool other_full_precision = other_it.get_interval().is_a_number();
-                            if (this_full_precision && other_full_precision) {
-                                ret = this_it.get_interval()== other_it.get_interval();
-                                break;
-                            }
-
-                            bool this_is_lower = this_it.get_interval()< other_it.get_interval();
-                            bool other_is_lower = other_it.get_interval()< this_it.get_interval();
-                            if (this_is_lower || other_is_lower) {
-                                ret = false;
-                                break;
-                            }
-                        }
-
-                        // If the precision is reached and the numbers full precision is not reached, then
-                        // we cannot know if they are equals or not.
-                        if(p==current_precision)
-                            throw boost::real::precision_exception();
-
-                    },
-
-                    [this, &ret] (auto tmp, real_rational<T> rat_num){
-                        real<T> other; // representing "other" number, which is a rational number
-                        if(rat_num.b==literals::one_integer<T>)   
-                            other._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
-                        else {
-                            real _a, _b; // to represent "a" and "b" in rational number a/b
-                            _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
-
-                            _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.b));
-
-                            other._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
-
-                        }
-
-                        auto this_it = this->_real_p->get_precision_itr().cbegin();
-                        auto other_it = other._real_p->get_precision_itr().cbegin();
-
-                        unsigned int current_precision = std::max(this->maximum_precision(), other.maximum_precision());
-                        unsigned int p;
-                        for (p = 0; p < current_precision; ++p) {
-                            // Get more precision
-                            ++this_it;
-                            ++other_it;
-
-                            bool this_full_precision = this_it.get_interval().is_a_number();
-                            bool other_full_precision = other_it.get_interval().is_a_number();
-                            if (this_full_precision && other_full_precision) {
-                                ret = this_it.get_interval()== other_it.get_interval();
-                                break;
-                            }
-
-                            bool this_is_lower = this_it.get_interval()< other_it.get_interval();
-                            bool other_is_lower = other_it.get_interval()< this_it.get_interval();
-                            if (this_is_lower || other_is_lower) {
-                                ret = false;
-                                break;
-                            }
-                        }
-
-                        // If the precision is reached and the numbers full precision is not reached, then
-                        // we cannot know if they are equals or not.
-                        if(p == current_precision)
-                            throw boost::real::precision_exception();
-
-                    },
-
-                    [this, &other, &ret] (auto a, auto b){
-                        auto this_it = this->_real_p->get_precision_itr().cbegin();
-                        auto other_it = other._real_p->get_precision_itr().cbegin();
-
-                        unsigned int current_precision = std::max(this->maximum_precision(), other.maximum_precision());
-                        unsigned int p;
-                        for (p = 0; p < current_precision; ++p) {
-                            // Get more precision
-                            ++this_it;
-                            ++other_it;
-
-                            bool this_full_precision = this_it.get_interval().is_a_number();
-                            bool other_full_precision = other_it.get_interval().is_a_number();
-                            if (this_full_precision && other_full_precision) {
-                                ret = this_it.get_interval()== other_it.get_interval();
-                                break;
-                            }
-
-                            bool this_is_lower = this_it.get_interval()< other_it.get_interval();
-                            bool other_is_lower = other_it.get_interval()< this_it.get_interval();
-                            if (this_is_lower || other_is_lower) {
-                                ret = false;
-                                break;
-                            }
-                        }
-
-                        // If the precision is reached and the numbers full precision is not reached, then
-                        // we cannot know if they are equals or not.
-                        if(p == current_precision)
-                            throw boost::real::precision_exception();
-
-                    } 
-
-                }, _real_p->get_real_number(), other._real_p->get_real_number());
-
-                return ret;
+                ORDER order = compare(other).order;
+                if (order == ORDER::UNDECIDED) {
+                    throw boost::real::precision_exception();
+                }
+                return order == ORDER::EQUAL;
             }
             /********* END OPERATORS *********/
 
@@ -1920,7 +1300,7 @@ namespace boost {
                         throw expected_real_integer_type_number();
                     }
                     this->_real_p = 
-                        std::make_shared<real_data<T>>(real_explicit<T>(a.a));
+                        node_table<T>::make(real_explicit<T>(a.a));
                 },
                 [] (auto a){
                     throw expected_real_integer_type_number();
@@ -1938,12 +1318,12 @@ namespace boost {
                 [this] (real_rational<T> rat_num){
                     real _a, _b;
                     _a._real_p = 
-                        std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
+                        node_table<T>::make(real_explicit<T>(rat_num.a));
                     _b._real_p = 
-                        std::make_shared<real_data<T>>(real_explicit<T>(rat_num.b));
+                        node_table<T>::make(real_explicit<T>(rat_num.b));
 
                     this->_real_p = 
-                        std::make_shared<real_data<T>>(real_operation<T>(_a, _b, OPERATION::DIVISION));
+                        node_table<T>::make(real_operation<T>(_a, _b, OPERATION::DIVISION));
                 },
                 [] (auto tmp){
                     throw expected_real_rational_type_number();
@@ -1972,6 +1352,29 @@ namespace boost {
 
         }; // end real class
 
+        /**
+         * @brief Compares a against b without throwing, see boost::real::real::compare.
+         *
+         * @return a boost::real::comparison with the order of a with respect to b, which is
+         * UNDECIDED if it can not be determined within the policy maximum precision.
+         */
+        template <typename T>
+        comparison compare(const real<T>& a, const real<T>& b, precision_policy policy = {}) {
+            return a.compare(b, policy);
+        }
+
+        /// the polynomial with the given coefficients at x, the one of x^k at index k, see boost::real::real::polyval
+        template <typename T>
+        real<T> polyval(const std::vector<real<T>>& coefficients, const real<T>& x) {
+            return real<T>::polyval(coefficients, x);
+        }
+
+        /// the user defined function f at x, see boost::real::real::apply
+        template <typename T>
+        real<T> apply(const real_function<T>& f, const real<T>& x) {
+            return real<T>::apply(f, x);
+        }
+
         namespace literals{
             template<typename T>
             const real<T> one_real = real<T>("1");
@@ -1,10 +1,14 @@
 #ifndef BOOST_REAL_REAL_DATA_HPP
 #define BOOST_REAL_REAL_DATA_HPP
 
+#include <algorithm>
 #include <variant>
 #include <assert.h>
 #include <iostream>
 #include <limits>
+#include <optional>
+#include <unordered_set>
+#include <vector>
 
 #include <real/const_precision_iterator.hpp>
 #include <real/interval.hpp>
@@ -13,8 +17,14 @@
 #include <real/real_operation.hpp>
 #include <real/real_exception.hpp>
 #include <real/real_rational.hpp>
+#include <real/real_enclosure.hpp>
+#include <real/enclosure_cache.hpp>
+#include <real/centered_form.hpp>
 #include <real/integer_number.hpp>
 #include <real/real_math.hpp>
+#include <real/interval_arithmetic.hpp>
+#include <real/double_interval.hpp>
+#include <real/double_double_interval.hpp>
 
 namespace boost { 
     namespace real{
@@ -24,19 +34,187 @@ namespace boost {
             real_number<T> _real;
             const_precision_iterator<T> _precision_itr;
 
+            /// cached double enclosure of the number, see double_enclosure()
+            std::optional<double_interval> _double_enclosure;
+
+            /// cached double-double enclosure of the number, see double_double_enclosure()
+            std::optional<double_double_interval> _double_double_enclosure;
+
+            /// the number of nodes of the longest path from this node to a leaf, see depth()
+            size_t _depth = 1;
+
+            /// the operations which have this node as operand, only kept for the reactive nodes
+            std::vector<real_data<T>*> _parents;
+
+            /// true for the inputs and the operations which depend on an input, see reactive()
+            bool _reactive = false;
+
+            /// true for the inputs, see input()
+            bool _input = false;
+
+            /// the operands of the node, if it is an operation
+            template <typename F>
+            void for_each_operand(F f) const {
+                if (const real_operation<T>* ro = std::get_if<real_operation<T>>(&_real)) {
+                    f(ro->lhs().get());
+                    f(ro->rhs().get());
+                    for (const auto& coefficient : ro->coefficients()) {
+                        f(coefficient.get());
+                    }
+                }
+            }
+
+            /// registers the node as a parent of its reactive operands, which makes it reactive
+            void attach() {
+                for_each_operand([this] (real_data<T>* operand) {
+                    if (operand->_reactive) {
+                        _reactive = true;
+                        if (std::find(operand->_parents.begin(), operand->_parents.end(), this) == operand->_parents.end()) {
+                            operand->_parents.push_back(this);
+                        }
+                    }
+                });
+            }
+
+            void detach() {
+                for_each_operand([this] (real_data<T>* operand) {
+                    operand->_parents.erase(std::remove(operand->_parents.begin(), operand->_parents.end(), this),
+                                            operand->_parents.end());
+                });
+            }
+
+            /// appends the nodes depending on x, and x, to order, every node after the nodes depending on it
+            static void dependents(real_data<T>* x, std::unordered_set<real_data<T>*>& visited, std::vector<real_data<T>*>& order) {
+                if (!visited.insert(x).second) {
+                    return;
+                }
+                for (real_data<T>* parent : x->_parents) {
+                    dependents(parent, visited, order);
+                }
+                order.push_back(x);
+            }
+
+            /**
+             * @brief Restarts the approximations of the input and of the nodes depending on it, each
+             * after its operands, so that every interval is computed again from the new value. The
+             * other nodes keep their intervals, which are reused when the dependent nodes are refined.
+             */
+            void restart_dependents() {
+                std::unordered_set<real_data<T>*> visited;
+                std::vector<real_data<T>*> order;
+                dependents(this, visited, order);
+
+                _precision_itr.restart(&_real);
+                _double_enclosure.reset();
+                _double_double_enclosure.reset();
+                order.pop_back();
+                for (auto it = order.rbegin(); it != order.rend(); ++it) {
+                    (*it)->_precision_itr.restart();
+                    (*it)->_double_enclosure.reset();
+                    (*it)->_double_double_enclosure.reset();
+                }
+            }
+
             public:
             /// @TODO: use move constructors, if possible
             
             real_data() = default;
             
             /// copy ctor - constructs real_data from other real_data
-            real_data(const real_data<T> &other) : _real(other._real), _precision_itr(other._precision_itr) {};
+            real_data(const real_data<T> &other) : _real(other._real), _precision_itr(other._precision_itr), _double_enclosure(other._double_enclosure),
+                                                   _double_double_enclosure(other._double_double_enclosure), _depth(other._depth) {
+                // a copy of an input is a constant
+                attach();
+            };
 
             // construct from the three different reals 
             real_data(real_explicit<T> x) :_real(x), _precision_itr(&_real) {};
             real_data(real_algorithm<T> x) : _real(x), _precision_itr(&_real) {};
-            real_data(real_operation<T> x) : _real(x), _precision_itr(&_real) {};
+            real_data(real_operation<T> x) : _real(x), _precision_itr(&_real),
+                                             _depth(1 + std::max(x.lhs()->depth(), x.rhs()->depth())) {
+                for (const auto& coefficient : x.coefficients()) {
+                    _depth = std::max(_depth, 1 + coefficient->depth());
+                }
+                attach();
+            };
             real_data(real_rational<T> x) : _real(x), _precision_itr(&_real) {};
+            real_data(real_enclosure<T> x) : _real(x), _precision_itr(&_real) {};
+
+            ~real_data() {
+                enclosure_cache<T>::forget(this);
+                detach();
+            }
+
+            /// a new input of the value of x, see boost::real::real_input
+            static std::shared_ptr<real_data<T>> make_input(const real_data<T>& x) {
+                auto result = std::make_shared<real_data<T>>(x);
+                result->_reactive = true;
+                result->_input = true;
+                return result;
+            }
+
+            /// true for the inputs, which are leaves of the operations even if their value is an operation
+            bool input() const {
+                return _input;
+            }
+
+            /**
+             * @brief true for the inputs, whose value can be replaced, and for the operations which
+             * depend on an input. Their values are not constants for the node_table and the
+             * simplifier.
+             */
+            bool reactive() const {
+                return _reactive;
+            }
+
+            /**
+             * @brief Replaces the value of an input by the number of the node x, and restarts the
+             * approximations of the nodes which depend on the input, see restart_dependents.
+             *
+             * @throws the exceptions of the first approximation of the dependent nodes, e.g.
+             * boost::real::divergent_division_result_exception if a divisor becomes zero. The input
+             * then keeps its previous value.
+             */
+            void set_value(const real_data<T>& x) {
+                real_number<T> previous = _real;
+                size_t previous_depth = _depth;
+                _real = x._real;
+                _depth = x._depth;
+                try {
+                    restart_dependents();
+                } catch (...) {
+                    _real = previous;
+                    _depth = previous_depth;
+                    restart_dependents();
+                    throw;
+                }
+            }
+
+            /// an estimate of the memory held by the approximation interval, in bytes
+            size_t enclosure_bytes() const {
+                return 2 * _precision_itr.get_precision() * sizeof(T);
+            }
+
+            /**
+             * @brief Restarts the approximation of an operation at its first precision, to release
+             * the memory of its interval, see boost::real::enclosure_cache. Other nodes are not
+             * modified, nor the operations whose first interval can not be computed.
+             */
+            void evict_enclosure() {
+                if (std::holds_alternative<real_operation<T>>(_real) && _precision_itr.get_precision() > 1) {
+                    try {
+                        _precision_itr.restart();
+                    } catch (const std::exception&) {
+                        // e.g. a division by an interval containing zero, the interval is kept
+                    }
+                }
+            }
+
+            /// the number of nodes of the longest path from this node to a leaf, one for leaves
+            size_t depth() const {
+                return _depth;
+            }
+
             const real_number<T>& get_real_number() const {
                 return _real;
             }
@@ -48,35 +226,175 @@ namespace boost {
             const_precision_iterator<T>& get_precision_itr() {
                 return _precision_itr;
             }
+
+            /**
+             * @brief Returns an enclosure of the number in double interval arithmetic. It is
+             * computed once, from the operands enclosures for operations and from the full digits
+             * for explicit numbers. Other numbers use their current approximation interval.
+             */
+            const double_interval& double_enclosure() {
+                if (!_double_enclosure) {
+                    _double_enclosure = std::visit(overloaded {
+                        [] (const real_explicit<T>& real) {
+                            return enclose(real.digits(), real.exponent(), real.positive());
+                        },
+                        [] (const real_operation<T>& real) {
+                            return operation_double_enclosure(real);
+                        },
+                        [this] (const auto&) {
+                            return double_interval {enclose(_precision_itr.get_interval().lower_bound).lower,
+                                                    enclose(_precision_itr.get_interval().upper_bound).upper};
+                        }
+                    }, _real);
+                }
+                return *_double_enclosure;
+            }
+
+            /// evaluates an operation in double interval arithmetic
+            static double_interval operation_double_enclosure(const real_operation<T>& ro) {
+                const double_interval& lhs = ro.lhs()->double_enclosure();
+
+                switch (ro.get_operation()) {
+                    case OPERATION::ADDITION:
+                        return lhs + ro.rhs()->double_enclosure();
+                    case OPERATION::SUBTRACTION:
+                        return lhs - ro.rhs()->double_enclosure();
+                    case OPERATION::MULTIPLICATION:
+                        return lhs * ro.rhs()->double_enclosure();
+                    case OPERATION::DIVISION:
+                        return lhs / ro.rhs()->double_enclosure();
+                    case OPERATION::INTEGER_POWER: {
+                        const double_interval& rhs = ro.rhs()->double_enclosure();
+                        // only small natural exponents, the exact engine checks the others
+                        if (rhs.lower != rhs.upper || rhs.lower < 0 || rhs.lower > 1024 || std::floor(rhs.lower) != rhs.lower) {
+                            return double_interval();
+                        }
+                        return pow(lhs, (unsigned long) rhs.lower);
+                    }
+                    case OPERATION::EXPONENT:
+                        return exp(lhs);
+                    case OPERATION::LOGARITHM:
+                        return log(lhs);
+                    case OPERATION::SIN:
+                        return sin(lhs);
+                    case OPERATION::COS:
+                        return cos(lhs);
+                    case OPERATION::TAN:
+                        return sin(lhs) / cos(lhs);
+                    case OPERATION::COT:
+                        return cos(lhs) / sin(lhs);
+                    case OPERATION::SEC:
+                        return double_interval {1, 1} / cos(lhs);
+                    case OPERATION::COSEC:
+                        return double_interval {1, 1} / sin(lhs);
+                    case OPERATION::POLYNOMIAL: {
+                        const auto& coefficients = ro.coefficients();
+                        double_interval result = coefficients.back()->double_enclosure();
+                        for (size_t k = coefficients.size() - 1; k-- > 0;) {
+                            result = result * lhs + coefficients[k]->double_enclosure();
+                        }
+                        return result;
+                    }
+                    case OPERATION::FUNCTION:
+                        // the user defined kernels work on exact intervals only
+                        return double_interval();
+                }
+                return double_interval();
+            }
+
+            /**
+             * @brief Returns an enclosure of the number in double-double interval arithmetic, the
+             * tier used when the double enclosure is too wide. The basic operations keep about 100
+             * bits, the transcendental functions fall back to their double enclosure.
+             */
+            const double_double_interval& double_double_enclosure() {
+                if (!_double_double_enclosure) {
+                    _double_double_enclosure = std::visit(overloaded {
+                        [] (const real_explicit<T>& real) {
+                            return enclose_double_double(real.digits(), real.exponent(), real.positive());
+                        },
+                        [this] (const real_operation<T>& real) {
+                            return operation_double_double_enclosure(real);
+                        },
+                        [this] (const auto&) {
+                            return double_double_interval {enclose_double_double(_precision_itr.get_interval().lower_bound).lower,
+                                                           enclose_double_double(_precision_itr.get_interval().upper_bound).upper};
+                        }
+                    }, _real);
+                }
+                return *_double_double_enclosure;
+            }
+
+            /// evaluates an operation in double-double interval arithmetic
+            double_double_interval operation_double_double_enclosure(const real_operation<T>& ro) {
+                const double_double_interval& lhs = ro.lhs()->double_double_enclosure();
+
+                switch (ro.get_operation()) {
+                    case OPERATION::ADDITION:
+                        return lhs + ro.rhs()->double_double_enclosure();
+                    case OPERATION::SUBTRACTION:
+                        return lhs - ro.rhs()->double_double_enclosure();
+                    case OPERATION::MULTIPLICATION:
+                        return lhs * ro.rhs()->double_double_enclosure();
+                    case OPERATION::DIVISION:
+                        return lhs / ro.rhs()->double_double_enclosure();
+                    case OPERATION::INTEGER_POWER: {
+                        const double_interval& rhs = ro.rhs()->double_enclosure();
+                        if (rhs.lower != rhs.upper || rhs.lower < 0 || rhs.lower > 1024 || std::floor(rhs.lower) != rhs.lower) {
+                            return double_double_interval();
+                        }
+                        return pow(lhs, (unsigned long) rhs.lower);
+                    }
+                    default:
+                        return double_double_interval(double_enclosure());
+                }
+            }
         };
 
         // Now that real_data and const_precision_iterator have been defined, we may now define the following.
         // Note these are all inline to avoid linker issues.
 
+        /**
+         * @brief the precision, in digits, the operands of ro need for the precision of ro: the
+         * precision itself, or for a FUNCTION with a Lipschitz constant the precision its result
+         * needs from its argument, see boost::real::real_function::argument_bits
+         */
+        template <typename T>
+        inline precision_t operand_precision(real_operation<T> &ro, const interval<T>& current, precision_t precision) {
+            const real_function<T>* function = ro.function();
+            if (function == nullptr) {
+                return precision;
+            }
+            size_t bits = function->argument_bits(ro.get_lhs_itr().get_interval(), current, precision * exact_number<T>::BITS_PER_DIGIT);
+            return std::max(precision, exact_number<T>::digits_for_bits(bits));
+        }
+
         /* const_precision_iterator member functions */
         /// determines a real_operation's approximation interval from its operands'
         template <typename T>
         inline void const_precision_iterator<T>::update_operation_boundaries(real_operation<T> &ro) {
             switch (ro.get_operation()) {
+                // the additive kernels read single bounds, so the pending bounds of leaf operands
+                // are built in temporaries and the leaves stay unmaterialized
                 case OPERATION::ADDITION:
                     this->_approximation_interval.lower_bound =
-                            ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false) +
-                            ro.get_rhs_itr().get_interval().lower_bound.up_to(_precision, false);
+                            ro.get_lhs_itr().bound_up_to_bits(false, precision_bits()) +
+                            ro.get_rhs_itr().bound_up_to_bits(false, precision_bits());
 
                     this->_approximation_interval.upper_bound =
-                            ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true) +
-                            ro.get_rhs_itr().get_interval().upper_bound.up_to(_precision, true);
+                            ro.get_lhs_itr().bound_up_to_bits(true, precision_bits()) +
+                            ro.get_rhs_itr().bound_up_to_bits(true, precision_bits());
                     break;
 
 
                 case OPERATION::SUBTRACTION:
                     this->_approximation_interval.lower_bound =
-                            ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false) -
-                            ro.get_rhs_itr().get_interval().upper_bound.up_to(_precision, true);
+                            ro.get_lhs_itr().bound_up_to_bits(false, precision_bits()) -
+                            ro.get_rhs_itr().bound_up_to_bits(true, precision_bits());
 
                     this->_approximation_interval.upper_bound =
-                            ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true) -
-                            ro.get_rhs_itr().get_interval().lower_bound.up_to(_precision, false);
+                            ro.get_lhs_itr().bound_up_to_bits(true, precision_bits()) -
+                            ro.get_rhs_itr().bound_up_to_bits(false, precision_bits());
                     break;
 
                 case OPERATION::MULTIPLICATION: {
@@ -87,38 +405,38 @@ namespace boost {
 
                     if (lhs_positive && rhs_positive) { // Positive - Positive
                         this->_approximation_interval.lower_bound =
-                                ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false) *
-                                ro.get_rhs_itr().get_interval().lower_bound.up_to(_precision, false);
+                                ro.get_lhs_itr().get_interval().lower_bound.up_to_bits(precision_bits(), false) *
+                                ro.get_rhs_itr().get_interval().lower_bound.up_to_bits(precision_bits(), false);
 
                         this->_approximation_interval.upper_bound =
-                                ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true) *
-                                ro.get_rhs_itr().get_interval().upper_bound.up_to(_precision, true);
+                                ro.get_lhs_itr().get_interval().upper_bound.up_to_bits(precision_bits(), true) *
+                                ro.get_rhs_itr().get_interval().upper_bound.up_to_bits(precision_bits(), true);
 
                     } else if (lhs_negative && rhs_negative) { // Negative - Negative
                         this->_approximation_interval.lower_bound =
-                                ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true) *
-                                ro.get_rhs_itr().get_interval().upper_bound.up_to(_precision, true);
+                                ro.get_lhs_itr().get_interval().upper_bound.up_to_bits(precision_bits(), true) *
+                                ro.get_rhs_itr().get_interval().upper_bound.up_to_bits(precision_bits(), true);
 
                         this->_approximation_interval.upper_bound =
-                                ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false) *
-                                ro.get_rhs_itr().get_interval().lower_bound.up_to(_precision, false);
+                                ro.get_lhs_itr().get_interval().lower_bound.up_to_bits(precision_bits(), false) *
+                                ro.get_rhs_itr().get_interval().lower_bound.up_to_bits(precision_bits(), false);
                     } else if (lhs_negative && rhs_positive) { // Negative - Positive
                         this->_approximation_interval.lower_bound =
-                                ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false) *
-                                ro.get_rhs_itr().get_interval().upper_bound.up_to(_precision, true);
+                                ro.get_lhs_itr().get_interval().lower_bound.up_to_bits(precision_bits(), false) *
+                                ro.get_rhs_itr().get_interval().upper_bound.up_to_bits(precision_bits(), true);
 
                         this->_approximation_interval.upper_bound =
-                                ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true) *
-                                ro.get_rhs_itr().get_interval().lower_bound.up_to(_precision, false);
+                                ro.get_lhs_itr().get_interval().upper_bound.up_to_bits(precision_bits(), true) *
+                                ro.get_rhs_itr().get_interval().lower_bound.up_to_bits(precision_bits(), false);
 
                     } else if (lhs_positive && rhs_negative) { // Positive - Negative
                         this->_approximation_interval.lower_bound =
-                                ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true) *
-                                ro.get_rhs_itr().get_interval().lower_bound.up_to(_precision, false);
+                                ro.get_lhs_itr().get_interval().upper_bound.up_to_bits(precision_bits(), true) *
+                                ro.get_rhs_itr().get_interval().lower_bound.up_to_bits(precision_bits(), false);
 
                         this->_approximation_interval.upper_bound =
-                                ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false) *
-                                ro.get_rhs_itr().get_interval().upper_bound.up_to(_precision, true);
+                                ro.get_lhs_itr().get_interval().lower_bound.up_to_bits(precision_bits(), false) *
+                                ro.get_rhs_itr().get_interval().upper_bound.up_to_bits(precision_bits(), true);
 
                     } else { // One is around zero all possible combinations are be tested
 
@@ -126,19 +444,19 @@ namespace boost {
 
                         // Lower * Lower
                         current_boundary =
-                                ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false) *
-                                ro.get_rhs_itr().get_interval().lower_bound.up_to(_precision, false);
+                                ro.get_lhs_itr().get_interval().lower_bound.up_to_bits(precision_bits(), false) *
+                                ro.get_rhs_itr().get_interval().lower_bound.up_to_bits(precision_bits(), false);
 
                         this->_approximation_interval.lower_bound = current_boundary;
                         this->_approximation_interval.upper_bound = current_boundary;
 
                         // Upper * upper
                         current_boundary =
-                                ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true) *
-                                ro.get_rhs_itr().get_interval().upper_bound.up_to(_precision, true);
+                                ro.get_lhs_itr().get_interval().upper_bound.up_to_bits(precision_bits(), true) *
+                                ro.get_rhs_itr().get_interval().upper_bound.up_to_bits(precision_bits(), true);
 
                         if (current_boundary < this->_approximation_interval.lower_bound) {
-                            this->_approximation_interval.lower_bound.up_to(_precision, false) = current_boundary;
+                            this->_approximation_interval.lower_bound = current_boundary;
                         }
 
                         if (this->_approximation_interval.upper_bound < current_boundary) {
@@ -147,10 +465,10 @@ namespace boost {
 
                         // Lower * upper
                         current_boundary =
-                                ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false) *
-                                ro.get_rhs_itr().get_interval().upper_bound.up_to(_precision, true);
+                                ro.get_lhs_itr().get_interval().lower_bound.up_to_bits(precision_bits(), false) *
+                                ro.get_rhs_itr().get_interval().upper_bound.up_to_bits(precision_bits(), true);
 
-                        if (current_boundary < this->_approximation_interval.lower_bound.up_to(_precision, false)) {
+                        if (current_boundary < this->_approximation_interval.lower_bound) {
                             this->_approximation_interval.lower_bound = current_boundary;
                         }
 
@@ -160,10 +478,10 @@ namespace boost {
 
                         // Upper * lower
                         current_boundary =
-                                ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true) *
-                                ro.get_rhs_itr().get_interval().lower_bound.up_to(_precision, false);
+                                ro.get_lhs_itr().get_interval().upper_bound.up_to_bits(precision_bits(), true) *
+                                ro.get_rhs_itr().get_interval().lower_bound.up_to_bits(precision_bits(), false);
 
-                        if (current_boundary < this->_approximation_interval.lower_bound.up_to(_precision, false)) {
+                        if (current_boundary < this->_approximation_interval.lower_bound) {
                             this->_approximation_interval.lower_bound = current_boundary;
                         }
 
@@ -231,7 +549,8 @@ namespace boost {
                     }
 
                     quotient = numerator;
-                    quotient.divide_vector(denominator, this->_precision, deviation_upper_boundary);
+                    quotient.divide_vector_bits(denominator, precision_bits(), deviation_upper_boundary,
+                        kernel_mode((double) numerator.leading_bit() - denominator.leading_bit()));
 
                     this->_approximation_interval.upper_bound = quotient;
 
@@ -269,7 +588,8 @@ namespace boost {
                     }
 
                     quotient = numerator;
-                    quotient.divide_vector(denominator, this->_precision, deviation_lower_boundary );
+                    quotient.divide_vector_bits(denominator, precision_bits(), deviation_lower_boundary,
+                        kernel_mode((double) numerator.leading_bit() - denominator.leading_bit()));
 
                     this->_approximation_interval.lower_bound = quotient;
 
@@ -346,20 +666,22 @@ namespace boost {
 
                 case OPERATION::EXPONENT :{
                     this->_approximation_interval.lower_bound = 
-                        exponent(ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false), _precision, false);
+                        exponent(ro.get_lhs_itr().get_interval().lower_bound.up_to_bits(precision_bits(), false), precision_bits(), false,
+                        kernel_mode(exponent_magnitude_bits(ro.get_lhs_itr().get_interval().lower_bound)));
                     this->_approximation_interval.upper_bound = 
-                        exponent(ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true), _precision, true);
+                        exponent(ro.get_lhs_itr().get_interval().upper_bound.up_to_bits(precision_bits(), true), precision_bits(), true,
+                        kernel_mode(exponent_magnitude_bits(ro.get_lhs_itr().get_interval().upper_bound)));
                     break;
                 }
 
                 case OPERATION::LOGARITHM :{
                     // if upper bound of number is zero or negative, then it is sure that number is out of domain
-                    if(ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true) == literals::zero_exact<T> || ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true).positive == false){
+                    if(ro.get_lhs_itr().get_interval().upper_bound.up_to_bits(precision_bits(), true) == literals::zero_exact<T> || ro.get_lhs_itr().get_interval().upper_bound.up_to_bits(precision_bits(), true).positive == false){
                         throw logarithm_not_defined_for_non_positive_number();
                     }
                     // now if we get our lower bound as negative, then we iterate for more precise input, until maximum precision is reached or we get positive lower bound
                     while(true){
-                        if(ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, true) == literals::zero_exact<T> || ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, true).positive == false){
+                        if(ro.get_lhs_itr().get_interval().lower_bound.up_to_bits(precision_bits(), true) == literals::zero_exact<T> || ro.get_lhs_itr().get_interval().lower_bound.up_to_bits(precision_bits(), true).positive == false){
                             if(_precision >= ro.get_lhs_itr().maximum_precision()){
                                         throw logarithm_not_defined_for_non_positive_number();
                             }
@@ -369,15 +691,19 @@ namespace boost {
                         else break;
                     }
                     this->_approximation_interval.lower_bound = 
-                        logarithm(ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false), _precision, false);
+                        logarithm(ro.get_lhs_itr().get_interval().lower_bound.up_to_bits(precision_bits(), false), precision_bits(), false,
+                        kernel_mode(logarithm_magnitude_bits(ro.get_lhs_itr().get_interval().lower_bound)));
                     this->_approximation_interval.upper_bound = 
-                        logarithm(ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true), _precision, true);
+                        logarithm(ro.get_lhs_itr().get_interval().upper_bound.up_to_bits(precision_bits(), true), precision_bits(), true,
+                        kernel_mode(logarithm_magnitude_bits(ro.get_lhs_itr().get_interval().upper_bound)));
                     break;
                 }
 
                 case OPERATION::SIN :{
-                    auto [sin_lower, cos_lower] = sin_cos(ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false), _precision, false);
-                    auto [sin_upper, cos_upper] = sin_cos(ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true), _precision, true);
+                    auto [sin_lower, cos_lower] = sin_cos(ro.get_lhs_itr().get_interval().lower_bound.up_to_bits(precision_bits(), false), precision_bits(), false,
+                        kernel_mode(sin_cos_magnitude_bits(ro.get_lhs_itr().get_interval().lower_bound)));
+                    auto [sin_upper, cos_upper] = sin_cos(ro.get_lhs_itr().get_interval().upper_bound.up_to_bits(precision_bits(), true), precision_bits(), true,
+                        kernel_mode(sin_cos_magnitude_bits(ro.get_lhs_itr().get_interval().upper_bound)));
                     // checking for sign change of derivative, detection of minima-maxima point
                     // if sign of both upper and lower bound of cos(x) is same, then there are no minima-maxima point in input interval
                     if(cos_upper.positive == cos_lower.positive){
@@ -415,8 +741,10 @@ namespace boost {
                 }
 
                 case OPERATION::COS :{
-                    auto [sin_lower, cos_lower] = sin_cos(ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false), _precision, false);
-                    auto [sin_upper, cos_upper] = sin_cos(ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true), _precision, true);
+                    auto [sin_lower, cos_lower] = sin_cos(ro.get_lhs_itr().get_interval().lower_bound.up_to_bits(precision_bits(), false), precision_bits(), false,
+                        kernel_mode(sin_cos_magnitude_bits(ro.get_lhs_itr().get_interval().lower_bound)));
+                    auto [sin_upper, cos_upper] = sin_cos(ro.get_lhs_itr().get_interval().upper_bound.up_to_bits(precision_bits(), true), precision_bits(), true,
+                        kernel_mode(sin_cos_magnitude_bits(ro.get_lhs_itr().get_interval().upper_bound)));
                     // checking for sign change of derivative, detection of minima-maxima point
                     // if sign of both upper and lower bound of cos(x) is same, then there are no minima-maxima point in input interval
                     if(sin_upper.positive == sin_lower.positive){
@@ -457,8 +785,10 @@ namespace boost {
                     exact_number<T> sin_lower, cos_lower, sin_upper, cos_upper;           
                     while(true)
                     {
-                        auto [sin_lower_tmp, cos_lower_tmp] = sin_cos(ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false), _precision, false);
-                        auto [sin_upper_tmp, cos_upper_tmp] = sin_cos(ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true), _precision, true);
+                        auto [sin_lower_tmp, cos_lower_tmp] = sin_cos(ro.get_lhs_itr().get_interval().lower_bound.up_to_bits(precision_bits(), false), precision_bits(), false,
+                        kernel_mode(sin_cos_magnitude_bits(ro.get_lhs_itr().get_interval().lower_bound)));
+                        auto [sin_upper_tmp, cos_upper_tmp] = sin_cos(ro.get_lhs_itr().get_interval().upper_bound.up_to_bits(precision_bits(), true), precision_bits(), true,
+                        kernel_mode(sin_cos_magnitude_bits(ro.get_lhs_itr().get_interval().upper_bound)));
 
                             // if we have point of maxima of minima in our input interval
                             if(cos_upper_tmp.positive != cos_lower_tmp.positive || cos_lower_tmp == literals::zero_exact<T> || cos_upper_tmp == literals::zero_exact<T>){
@@ -477,8 +807,8 @@ namespace boost {
                                 break;
                             }
                     }
-                    sin_lower.divide_vector(cos_lower, _precision, false);
-                    sin_upper.divide_vector(cos_upper, _precision, true);
+                    sin_lower.divide_vector_bits(cos_lower, precision_bits(), false);
+                    sin_upper.divide_vector_bits(cos_upper, precision_bits(), true);
                     this->_approximation_interval.lower_bound = sin_lower;
                     this->_approximation_interval.upper_bound = sin_upper;
                     break;
@@ -489,8 +819,10 @@ namespace boost {
                     exact_number<T> sin_lower, cos_lower, sin_upper, cos_upper;                   
                     while(true)
                     {
-                        auto [sin_lower_tmp, cos_lower_tmp] = sin_cos(ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false), _precision, false);
-                        auto [sin_upper_tmp, cos_upper_tmp] = sin_cos(ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true), _precision, true);
+                        auto [sin_lower_tmp, cos_lower_tmp] = sin_cos(ro.get_lhs_itr().get_interval().lower_bound.up_to_bits(precision_bits(), false), precision_bits(), false,
+                        kernel_mode(sin_cos_magnitude_bits(ro.get_lhs_itr().get_interval().lower_bound)));
+                        auto [sin_upper_tmp, cos_upper_tmp] = sin_cos(ro.get_lhs_itr().get_interval().upper_bound.up_to_bits(precision_bits(), true), precision_bits(), true,
+                        kernel_mode(sin_cos_magnitude_bits(ro.get_lhs_itr().get_interval().upper_bound)));
 
                             // if we have point of maxima of minima in our input interval
                             if(sin_upper_tmp.positive != sin_lower_tmp.positive || sin_lower_tmp == literals::zero_exact<T> || sin_upper_tmp == literals::zero_exact<T>){
@@ -509,8 +841,8 @@ namespace boost {
                                 break;
                             }
                     }
-                    cos_lower.divide_vector(sin_lower, _precision, false);
-                    cos_upper.divide_vector(sin_upper, _precision, true);
+                    cos_lower.divide_vector_bits(sin_lower, precision_bits(), false);
+                    cos_upper.divide_vector_bits(sin_upper, precision_bits(), true);
                     this->_approximation_interval.lower_bound = cos_upper;
                     this->_approximation_interval.upper_bound = cos_lower;
                     break;
@@ -521,8 +853,10 @@ namespace boost {
                     exact_number<T> sin_lower, cos_lower, sin_upper, cos_upper;
 
                     while(true){
-                        auto [sin_lower_tmp, cos_lower_tmp] = sin_cos(ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false), _precision, false);
-                        auto [sin_upper_tmp, cos_upper_tmp] = sin_cos(ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true), _precision, true);
+                        auto [sin_lower_tmp, cos_lower_tmp] = sin_cos(ro.get_lhs_itr().get_interval().lower_bound.up_to_bits(precision_bits(), false), precision_bits(), false,
+                        kernel_mode(sin_cos_magnitude_bits(ro.get_lhs_itr().get_interval().lower_bound)));
+                        auto [sin_upper_tmp, cos_upper_tmp] = sin_cos(ro.get_lhs_itr().get_interval().upper_bound.up_to_bits(precision_bits(), true), precision_bits(), true,
+                        kernel_mode(sin_cos_magnitude_bits(ro.get_lhs_itr().get_interval().upper_bound)));
                         // if we have point of maxima of minima in our input interval
                         if(cos_upper_tmp.positive != cos_lower_tmp.positive || cos_lower_tmp == literals::zero_exact<T> || cos_upper_tmp == literals::zero_exact<T>){
                             // updating the boundaries of lhs
@@ -543,11 +877,11 @@ namespace boost {
 
                     // derivative of sec(x) is sec(x)tan(x)
                     exact_number<T> derivative_lower = sin_lower;
-                    derivative_lower.divide_vector(cos_lower*cos_lower, _precision, false);
+                    derivative_lower.divide_vector_bits(cos_lower*cos_lower, precision_bits(), false);
                     
                     
                     exact_number<T> derivative_upper = sin_upper;
-                    derivative_upper.divide_vector(cos_upper*cos_upper, _precision, true); 
+                    derivative_upper.divide_vector_bits(cos_upper*cos_upper, precision_bits(), true); 
                     // checking for point of minima
                     if(derivative_lower.positive != derivative_upper.positive){
                         // if minima exists and either number is positive, then lower end of resulting interval is 1
@@ -555,20 +889,20 @@ namespace boost {
                             this->_approximation_interval.lower_bound = exact_number<T>("1");
                             this->_approximation_interval.upper_bound = exact_number<T>("1");
                             if(cos_upper > cos_lower){
-                                this->_approximation_interval.upper_bound.divide_vector(cos_lower, _precision, true);
+                                this->_approximation_interval.upper_bound.divide_vector_bits(cos_lower, precision_bits(), true);
                             }
                             else{
-                                this->_approximation_interval.upper_bound.divide_vector(cos_upper, _precision, true);
+                                this->_approximation_interval.upper_bound.divide_vector_bits(cos_upper, precision_bits(), true);
                             }
                         }
                         else{
                             this->_approximation_interval.upper_bound = exact_number<T>("-1");
                             this->_approximation_interval.lower_bound = exact_number<T>("1");
                             if(cos_upper > cos_lower){
-                                this->_approximation_interval.upper_bound.divide_vector(cos_lower, _precision, true);
+                                this->_approximation_interval.upper_bound.divide_vector_bits(cos_lower, precision_bits(), true);
                             }
                             else{
-                                this->_approximation_interval.upper_bound.divide_vector(cos_upper, _precision, true);
+                                this->_approximation_interval.upper_bound.divide_vector_bits(cos_upper, precision_bits(), true);
                             }
 
                         }
@@ -577,12 +911,12 @@ namespace boost {
                         this->_approximation_interval.upper_bound = exact_number<T>("1");
                         this->_approximation_interval.lower_bound = exact_number<T>("1");
                         if(cos_upper > cos_lower){
-                            this->_approximation_interval.lower_bound.divide_vector(cos_upper, _precision, false);
-                            this->_approximation_interval.upper_bound.divide_vector(cos_lower, _precision, true);
+                            this->_approximation_interval.lower_bound.divide_vector_bits(cos_upper, precision_bits(), false);
+                            this->_approximation_interval.upper_bound.divide_vector_bits(cos_lower, precision_bits(), true);
                         }
                         else{
-                            this->_approximation_interval.lower_bound.divide_vector(cos_lower, _precision, false);
-                            this->_approximation_interval.upper_bound.divide_vector(cos_upper, _precision, true);
+                            this->_approximation_interval.lower_bound.divide_vector_bits(cos_lower, precision_bits(), false);
+                            this->_approximation_interval.upper_bound.divide_vector_bits(cos_upper, precision_bits(), true);
                         }
                     }
 
@@ -593,8 +927,10 @@ namespace boost {
                     exact_number<T> sin_lower, cos_lower, sin_upper, cos_upper;
 
                     while(true){
-                        auto [sin_lower_tmp, cos_lower_tmp] = sin_cos(ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false), _precision, false);
-                        auto [sin_upper_tmp, cos_upper_tmp] = sin_cos(ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true), _precision, true);
+                        auto [sin_lower_tmp, cos_lower_tmp] = sin_cos(ro.get_lhs_itr().get_interval().lower_bound.up_to_bits(precision_bits(), false), precision_bits(), false,
+                        kernel_mode(sin_cos_magnitude_bits(ro.get_lhs_itr().get_interval().lower_bound)));
+                        auto [sin_upper_tmp, cos_upper_tmp] = sin_cos(ro.get_lhs_itr().get_interval().upper_bound.up_to_bits(precision_bits(), true), precision_bits(), true,
+                        kernel_mode(sin_cos_magnitude_bits(ro.get_lhs_itr().get_interval().upper_bound)));
                         // if we have point of maxima of minima in our input interval
                         if(sin_upper_tmp.positive != sin_lower_tmp.positive || sin_lower_tmp == literals::zero_exact<T> || sin_upper_tmp == literals::zero_exact<T>){
                             // updating the boundaries of lhs
@@ -615,11 +951,11 @@ namespace boost {
 
                     // derivative of sec(x) is sec(x)tan(x)
                     exact_number<T> derivative_lower = cos_lower;
-                    derivative_lower.divide_vector(sin_lower*sin_lower, _precision, false);
+                    derivative_lower.divide_vector_bits(sin_lower*sin_lower, precision_bits(), false);
                     
                     
                     exact_number<T> derivative_upper = cos_upper;
-                    derivative_upper.divide_vector(sin_upper*sin_upper, _precision, true); 
+                    derivative_upper.divide_vector_bits(sin_upper*sin_upper, precision_bits(), true); 
                     // checking for point of minima
                     if(derivative_lower.positive != derivative_upper.positive){
                         // if minima exists and either number is positive, then lower end of resulting interval is 1
@@ -627,20 +963,20 @@ namespace boost {
                             this->_approximation_interval.lower_bound = exact_number<T>("1");
                             this->_approximation_interval.upper_bound = exact_number<T>("1");
                             if(sin_upper > sin_lower){
-                                this->_approximation_interval.upper_bound.divide_vector(sin_lower, _precision, true);
+                                this->_approximation_interval.upper_bound.divide_vector_bits(sin_lower, precision_bits(), true);
                             }
                             else{
-                                this->_approximation_interval.upper_bound.divide_vector(sin_upper, _precision, true);
+                                this->_approximation_interval.upper_bound.divide_vector_bits(sin_upper, precision_bits(), true);
                             }
                         }
                         else{
                             this->_approximation_interval.upper_bound = exact_number<T>("-1");
                             this->_approximation_interval.lower_bound = exact_number<T>("1");
                             if(sin_upper > sin_lower){
-                                this->_approximation_interval.upper_bound.divide_vector(sin_lower, _precision, false);
+                                this->_approximation_interval.upper_bound.divide_vector_bits(sin_lower, precision_bits(), false);
                             }
                             else{
-                                this->_approximation_interval.upper_bound.divide_vector(sin_upper, _precision, false);
+                                this->_approximation_interval.upper_bound.divide_vector_bits(sin_upper, precision_bits(), false);
                             }
 
                         }
@@ -649,56 +985,132 @@ namespace boost {
                         this->_approximation_interval.upper_bound = exact_number<T>("1");
                         this->_approximation_interval.lower_bound = exact_number<T>("1");
                         if(sin_upper > sin_lower){
-                            this->_approximation_interval.lower_bound.divide_vector(sin_upper, _precision, false);
-                            this->_approximation_interval.upper_bound.divide_vector(sin_lower, _precision, true);
+                            this->_approximation_interval.lower_bound.divide_vector_bits(sin_upper, precision_bits(), false);
+                            this->_approximation_interval.upper_bound.divide_vector_bits(sin_lower, precision_bits(), true);
                         }
                         else{
-                            this->_approximation_interval.lower_bound.divide_vector(sin_lower, _precision, false);
-                            this->_approximation_interval.upper_bound.divide_vector(sin_upper, _precision, true);
+                            this->_approximation_interval.lower_bound.divide_vector_bits(sin_lower, precision_bits(), false);
+                            this->_approximation_interval.upper_bound.divide_vector_bits(sin_upper, precision_bits(), true);
                         }
                     }
 
                     break;
                 }
 
+                case OPERATION::FUNCTION: {
+                    // the kernel works with the bits of its argument, so a cancellation keeps the precision
+                    const real_function<T>* function = ro.function();
+                    size_t bits = function->argument_bits(ro.get_lhs_itr().get_interval(), this->_approximation_interval, precision_bits());
+                    this->_approximation_interval = function->enclose(ro.get_lhs_itr().get_interval(), bits);
+                    break;
+                }
+
+                case OPERATION::POLYNOMIAL: {
+                    std::vector<interval<T>> coefficients;
+                    coefficients.reserve(ro.coefficients().size());
+                    for (const auto& coefficient : ro.coefficients()) {
+                        coefficients.push_back(coefficient->get_precision_itr().get_interval());
+                    }
+                    this->_approximation_interval = polynomial(coefficients, ro.get_lhs_itr().get_interval(), precision_bits());
+                    break;
+                }
+
                 default:
                     throw boost::real::none_operation_exception();
             }
+
+            if (centered_form<T>::enabled) {
+                centered_form<T>::narrow(this->_approximation_interval, ro, precision_bits());
+            }
         }
 
         template <typename T>
         inline void const_precision_iterator<T>::operation_iterate_n_times(real_operation<T> &ro, int n) {
             /// @warning there could be issues if operands have different precisions/max precisions
+            typename enclosure_cache<T>::evaluation evaluation;
+
+            // operands are brought to the new precision, which also recomputes the operands
+            // restarted by the enclosure_cache
+            precision_t target = this->_precision + n;
+            precision_t operand_target = operand_precision(ro, this->_approximation_interval, target);
 
-            if (ro.get_lhs_itr()._precision < this->_precision + n) {
-                ro.get_lhs_itr().iterate_n_times(n);
+            if (ro.get_lhs_itr()._precision < operand_target) {
+                ro.get_lhs_itr().iterate_n_times(operand_target - ro.get_lhs_itr()._precision);
             }
             
-            if (ro.get_rhs_itr()._precision < this->_precision + n) {
-                ro.get_rhs_itr().iterate_n_times(n);
+            if (ro.get_rhs_itr()._precision < operand_target) {
+                ro.get_rhs_itr().iterate_n_times(operand_target - ro.get_rhs_itr()._precision);
+            }
+
+            for (const auto& coefficient : ro.coefficients()) {
+                if (coefficient->get_precision_itr()._precision < target) {
+                    coefficient->get_precision_itr().iterate_n_times(target - coefficient->get_precision_itr()._precision);
+                }
             }
 
             this->_precision += n;
 
             update_operation_boundaries(ro);
+            touch_operands(ro);
         }
 
         template <typename T>
         inline void const_precision_iterator<T>::operation_iterate(real_operation<T> &ro) {
             // only iterate if we must. If operand precision < this precision, then it must have
-            // hit its maximum_precision. If operand precision == this precision, we try iterating. Otherwise,
-            // it is == this->_precision + 1 (from being iterated elsewhere in the operation tree) and
-            // we do not iterate again.
+            // hit its maximum_precision or been restarted by the enclosure_cache, and it is brought
+            // to the new precision. Otherwise, it is == this->_precision + 1 (from being iterated
+            // elsewhere in the operation tree) and we do not iterate again.
+            typename enclosure_cache<T>::evaluation evaluation;
 
-            if (ro.get_lhs_itr()._precision == this->_precision)
-                ++(ro.get_lhs_itr());
+            precision_t operand_target = operand_precision(ro, this->_approximation_interval, this->_precision + 1);
+
+            if (ro.get_lhs_itr()._precision < operand_target)
+                ro.get_lhs_itr().iterate_n_times(operand_target - ro.get_lhs_itr()._precision);
             
-            if (ro.get_rhs_itr()._precision == this->_precision)
-                ++(ro.get_rhs_itr());
+            if (ro.get_rhs_itr()._precision < operand_target)
+                ro.get_rhs_itr().iterate_n_times(operand_target - ro.get_rhs_itr()._precision);
+
+            for (const auto& coefficient : ro.coefficients()) {
+                if (coefficient->get_precision_itr()._precision <= this->_precision)
+                    coefficient->get_precision_itr().iterate_n_times(this->_precision + 1 - coefficient->get_precision_itr()._precision);
+            }
 
             (this->_precision)++;
 
             update_operation_boundaries(ro);
+            touch_operands(ro);
+        }
+
+        template <typename T>
+        inline void const_precision_iterator<T>::operation_refine_to_bits(real_operation<T> &ro, precision_t bits) {
+            // operands are refined to the same amount of bits, the operation kernels then
+            // round to that amount of bits instead of whole digits.
+            typename enclosure_cache<T>::evaluation evaluation;
+
+            precision_t operand_bits = bits;
+            if (const real_function<T>* function = ro.function()) {
+                operand_bits = function->argument_bits(ro.get_lhs_itr().get_interval(), this->_approximation_interval, bits);
+            }
+            ro.get_lhs_itr().refine_to_bits(operand_bits);
+            ro.get_rhs_itr().refine_to_bits(operand_bits);
+            for (const auto& coefficient : ro.coefficients()) {
+                coefficient->get_precision_itr().refine_to_bits(bits);
+            }
+
+            this->_precision = exact_number<T>::digits_for_bits(bits);
+            this->_precision_bits = bits;
+
+            update_operation_boundaries(ro);
+            touch_operands(ro);
+        }
+
+        template <typename T>
+        inline void const_precision_iterator<T>::touch_operands(real_operation<T> &ro) {
+            enclosure_cache<T>::touch(ro.lhs().get());
+            enclosure_cache<T>::touch(ro.rhs().get());
+            for (const auto& coefficient : ro.coefficients()) {
+                enclosure_cache<T>::touch(coefficient.get());
+            }
         }
 
         /* real_operation member functions */
@@ -0,0 +1,73 @@
+#ifndef BOOST_REAL_REAL_ENCLOSURE_HPP
+#define BOOST_REAL_REAL_ENCLOSURE_HPP
+
+#include <cstddef>
+#include <functional>
+
+#include <real/interval.hpp>
+#include <real/exact_number.hpp>
+
+namespace boost {
+    namespace real {
+
+        /**
+         * @brief boost::real::real_enclosure is a leaf which represents a number by a fixed
+         * interval of exact numbers known to contain it. It is what a subtree becomes when it is
+         * materialized, see boost::real::real::materialize: the interval is the subtree
+         * approximation at the materialized precision, so it can not be refined any further.
+         *
+         * A leaf may also have a refinement, a function returning an enclosure of the number tight
+         * to a precision in bits. Its iterators then call it whenever they reach a new precision, so
+         * the number is refined lazily by an external method, see boost::real::find_root.
+         */
+        template <typename T = int>
+        class real_enclosure {
+            interval<T> _enclosure;
+            std::function<interval<T>(size_t)> _refinement;
+
+        public:
+
+            /**
+             * @brief *Default constructor:* Constructs an empty boost::real::real_enclosure with
+             * undefined representation and behaviour.
+             */
+            real_enclosure() = default;
+
+            /**
+             * @brief Constructs a leaf enclosed by the interval, which must be a rigorous enclosure
+             * of the represented number.
+             *
+             * @param enclosure - the interval which contains the number.
+             */
+            explicit real_enclosure(const interval<T>& enclosure) : _enclosure(enclosure) {}
+
+            /**
+             * @brief Constructs a leaf enclosed by the interval, whose iterators are refined by the
+             * refinement function.
+             *
+             * @param enclosure - the interval which contains the number, at the first precision.
+             * @param refinement - returns an interval which contains the number, and whose width is
+             * at most about 2^-bits times the number magnitude for a precision in bits.
+             */
+            real_enclosure(const interval<T>& enclosure, std::function<interval<T>(size_t)> refinement)
+                : _enclosure(enclosure), _refinement(std::move(refinement)) {}
+
+            /// the interval which contains the number, at the first precision
+            const interval<T>& get_interval() const {
+                return _enclosure;
+            }
+
+            /// true if the leaf has a refinement function
+            bool refinable() const {
+                return (bool) _refinement;
+            }
+
+            /// an interval which contains the number, tight to the precision in bits
+            interval<T> refine(size_t bits) const {
+                return _refinement(bits);
+            }
+        };
+    }
+}
+
+#endif // BOOST_REAL_REAL_ENCLOSURE_HPP
@@ -135,6 +135,48 @@ namespace boost {
                 return "Non-integral power of a negative number is a complex number";
             }
         };
+
+        struct invalid_tolerance_exception : public std::exception {
+            const char * what() const throw () override {
+                return "The tolerance must be a number greater than zero";
+            }
+        };
+
+        struct square_root_not_defined_for_negative_number : public std::exception {
+            const char * what() const throw () override {
+                return "Square root is only defined for non negative numbers (Complex Numbers not supported)";
+            }
+        };
+
+        struct real_vector_size_mismatch_exception : public std::exception {
+            const char * what() const throw () override {
+                return "The boost::real::real_vector operands must have the same size, or one of them a single row";
+            }
+        };
+
+        struct exact_dot_size_mismatch_exception : public std::exception {
+            const char * what() const throw () override {
+                return "The vectors of a dot product must have the same size";
+            }
+        };
+
+        struct root_not_bracketed_exception : public std::exception {
+            const char * what() const throw () override {
+                return "The function has no root in the bracket";
+            }
+        };
+
+        struct dependent_input_value_exception : public std::exception {
+            const char * what() const throw () override {
+                return "The value of a boost::real::real_input must not depend on an input";
+            }
+        };
+
+        struct invalid_snapshot_exception : public std::exception {
+            const char * what() const throw () override {
+                return "The stream does not hold a valid boost::real snapshot for this digit type";
+            }
+        };
         
 
     }
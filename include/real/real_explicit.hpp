@@ -174,6 +174,13 @@ namespace boost {
                
             }
 
+            /**
+             * @brief Creates a boost::real::real_explicit instance that represents the exact_number number.
+             *
+             * @param number - the boost::real::exact_number to represent.
+             */
+            explicit real_explicit(const exact_number<T>& number) : explicit_number(number) {}
+
             // constructor to convert an integer type rational number into an explicit number
             constexpr explicit real_explicit(integer_number<T> num){
                 int _exponent = 0;
@@ -0,0 +1,113 @@
+#ifndef BOOST_REAL_REAL_FUNCTION_HPP
+#define BOOST_REAL_REAL_FUNCTION_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include <real/interval.hpp>
+#include <real/exact_number.hpp>
+
+namespace boost {
+    namespace real {
+
+        enum class MONOTONICITY{NONE, INCREASING, DECREASING};
+
+        /**
+         * @brief boost::real::real_function is a user defined function of one argument, applied to
+         * a number as a FUNCTION operation node, see boost::real::apply. New functions are added
+         * this way without a new OPERATION or kernel in the library.
+         *
+         * The kernel receives an interval of the argument and a precision in bits, and must return
+         * an interval containing the values of the function on the whole argument interval, whose
+         * bounds have about that many significant bits. The metadata lets the library call it less
+         * often and plan the precision of the argument:
+         *
+         *  - a monotone function is only evaluated at the bounds of the argument interval, given to
+         *  the kernel as single number intervals;
+         *
+         *  - for a function with a Lipschitz constant L, |f(x) - f(y)| <= L |x - y| on the domain,
+         *  the result is also intersected with f(m) + L [-r, r] for the midpoint m and the radius r
+         *  of the argument interval, and the argument is refined to, and the kernel called with,
+         *  the bits the result needs, see argument_bits.
+         */
+        template <typename T = int>
+        struct real_function {
+            /// returns an enclosure of the function on the interval, with the precision in bits
+            std::function<interval<T>(const interval<T>&, size_t)> kernel;
+
+            MONOTONICITY monotonicity = MONOTONICITY::NONE;
+
+            /// a Lipschitz constant of the function on its domain, if it is known
+            std::optional<exact_number<T>> lipschitz;
+
+            /// the enclosure of the function on x with the precision in bits, using the metadata
+            interval<T> enclose(const interval<T>& x, size_t bits) const {
+                auto at = [this, bits] (const exact_number<T>& point) {
+                    interval<T> argument;
+                    argument.lower_bound = argument.upper_bound = point;
+                    return kernel(argument, bits);
+                };
+
+                interval<T> result;
+                switch (monotonicity) {
+                    case MONOTONICITY::INCREASING:
+                        result.lower_bound = at(x.lower_bound).lower_bound;
+                        result.upper_bound = at(x.upper_bound).upper_bound;
+                        break;
+                    case MONOTONICITY::DECREASING:
+                        result.lower_bound = at(x.upper_bound).lower_bound;
+                        result.upper_bound = at(x.lower_bound).upper_bound;
+                        break;
+                    default:
+                        result = kernel(x, bits);
+                }
+
+                if (lipschitz && !x.is_a_number() && monotonicity == MONOTONICITY::NONE) {
+                    // the midpoint is exact, since the base is even
+                    exact_number<T> half(std::vector<T> {(std::numeric_limits<T>::max() / 4)}, 0);
+                    exact_number<T> middle = (x.lower_bound + x.upper_bound) * half;
+                    middle.normalize();
+                    interval<T> center = at(middle);
+                    exact_number<T> radius = (*lipschitz).abs() * (x.upper_bound - middle);
+
+                    exact_number<T> lower = (center.lower_bound - radius).up_to_bits(bits, false);
+                    exact_number<T> upper = (center.upper_bound + radius).up_to_bits(bits, true);
+                    if (result.lower_bound < lower) {
+                        result.lower_bound = lower;
+                    }
+                    if (upper < result.upper_bound) {
+                        result.upper_bound = upper;
+                    }
+                }
+                return result;
+            }
+
+            /**
+             * @brief The bits the argument of the function needs for a result of the given bits, from
+             * the magnitudes of the current intervals of the argument x and of the result y: the
+             * width of the result is at most L times the width of the argument.
+             */
+            size_t argument_bits(const interval<T>& x, const interval<T>& y, size_t bits) const {
+                if (!lipschitz) {
+                    return bits;
+                }
+                int constant = (*lipschitz).leading_bit();
+                int argument = std::max(x.lower_bound.leading_bit(), x.upper_bound.leading_bit());
+                int result = std::max(y.lower_bound.leading_bit(), y.upper_bound.leading_bit());
+                if (constant == std::numeric_limits<int>::min() || argument == std::numeric_limits<int>::min() ||
+                    result == std::numeric_limits<int>::min() || y.lower_bound.positive != y.upper_bound.positive) {
+                    return bits;
+                }
+                // a result of the same sign does not cancel, its magnitude is kept at the new precision
+                int extra = std::min(constant + argument - result, (int) bits);
+                return extra > 0 ? bits + extra : bits;
+            }
+        };
+    }
+}
+
+#endif // BOOST_REAL_REAL_FUNCTION_HPP
@@ -0,0 +1,73 @@
+#ifndef BOOST_REAL_REAL_INPUT_HPP
+#define BOOST_REAL_REAL_INPUT_HPP
+
+#include <memory>
+#include <string>
+
+#include <real/real.hpp>
+
+namespace boost {
+    namespace real {
+
+        /**
+         * @brief A boost::real::real number whose value can be replaced after the numbers using it
+         * are built.
+         *
+         * The operations built on an input, directly or through other operations, are reactive:
+         * they register themselves as parents of their reactive operands. set() replaces the
+         * value of the input and restarts the approximations of its dependent nodes only, each
+         * after its operands, so the next evaluation of a dependent number computes again the
+         * nodes which depend on the input, and reuses the intervals already computed for the
+         * rest of the operation trees.
+         *
+         * Inputs are not constants: the operations on them are not folded, simplified away,
+         * hash-consed as leaves or materialized. The const_precision_iterators copied before a
+         * set() keep the intervals of the previous value. The nodes which depend on an input
+         * through a function, e.g. the roots of boost::real::find_root, are not restarted.
+         */
+        template <typename T = int>
+        class real_input : public real<T> {
+
+            static std::shared_ptr<real_data<T>> value_node(const real<T>& value) {
+                if (!value._real_p || std::holds_alternative<std::monostate>(value._real_p->get_real_number())) {
+                    throw invalid_representation_exception();
+                }
+                if (value._real_p->reactive()) {
+                    throw dependent_input_value_exception();
+                }
+                return value._real_p;
+            }
+
+        public:
+
+            /**
+             * @brief Constructs an input of the given value.
+             *
+             * @throws boost::real::dependent_input_value_exception if the value depends on an input.
+             */
+            explicit real_input(const real<T>& value) : real<T>(real_data<T>::make_input(*value_node(value))) {};
+
+            /// constructs an input of the value of the string, see the boost::real::real string constructor
+            explicit real_input(const std::string& value) : real_input(real<T>(value)) {};
+
+            /**
+             * @brief Replaces the value of the input, the numbers using it take the new value.
+             *
+             * @throws boost::real::dependent_input_value_exception if the value depends on an input.
+             * @throws the exceptions of the first approximation of the numbers using the input, e.g.
+             * boost::real::divergent_division_result_exception if a divisor becomes zero. The input
+             * then keeps its previous value.
+             */
+            void set(const real<T>& value) {
+                this->_real_p->set_value(*value_node(value));
+            }
+
+            /// replaces the value of the input by the value of the string
+            void set(const std::string& value) {
+                set(real<T>(value));
+            }
+        };
+    }
+}
+
+#endif // BOOST_REAL_REAL_INPUT_HPP
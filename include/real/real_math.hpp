@@ -2,27 +2,88 @@
 #define BOOST_REAL_MATH_HPP
 
 #include <tuple>
+#include <cmath>
 #include "real/exact_number.hpp"
 #include "real/real_exception.hpp"
 
 namespace boost{
 	namespace real{
+		/**
+		 * @brief: converts a relative precision into the absolute precision a kernel series has to reach
+		 * @param: significant_bits: requested amount of significant bits of the result
+		 * @param: magnitude_bits: estimated position of the leading bit of the result, see exact_number::leading_bit
+		 * @return: the absolute precision in bits. Big results need fewer bits and tiny results need more bits.
+		 *          A result estimated as zero has no magnitude to be relative to, so it keeps significant_bits.
+		 **/
+		inline size_t absolute_bits(size_t significant_bits, double magnitude_bits){
+			if (!std::isfinite(magnitude_bits))
+				return significant_bits;
+			double bits = (double) significant_bits - std::floor(magnitude_bits);
+			return (size_t) std::max(bits, 1.0);
+		}
+
+		/// estimates the position of the leading bit of e^x
+		template<typename T>
+		double exponent_magnitude_bits(const exact_number<T>& x){
+			return x.as_double() * 1.4426950408889634; // log2(e)
+		}
+
+		/// estimates the position of the leading bit of ln(x), x > 0
+		template<typename T>
+		double logarithm_magnitude_bits(const exact_number<T>& x){
+			// close to one, ln(x) is about x - 1, which is exact even if x has more than the three digits of a double estimate
+			exact_number<T> distance = x;
+			distance = distance - literals::one_exact<T>;
+			if (distance.abs() < literals::one_exact<T>) {
+				double d = distance.as_double();
+				if (std::abs(d) < 0.5)
+					return std::log2(std::abs(d));
+			}
+			// ln(x) = ln(0.d1d2...) + exponent * ln(base), which does not overflow a double
+			const double base = (double) ((std::numeric_limits<T>::max() / 4) * 2);
+			exact_number<T> mantissa = x;
+			mantissa.exponent = 0;
+			return std::log2(std::abs(std::log(mantissa.as_double()) + x.exponent * std::log(base)));
+		}
+
+		/// estimates the position of the leading bit of the smaller of sin(x) and cos(x)
+		template<typename T>
+		double sin_cos_magnitude_bits(const exact_number<T>& x){
+			double angle = x.as_double();
+			if (std::abs(angle) > 1e15) // the angle reduction of a double is meaningless there
+				return 0;
+			return std::log2(std::min(std::abs(std::sin(angle)), std::abs(std::cos(angle))));
+		}
+		/// sin and cos are within [-1, 1], which the directed rounding of their series may exceed
+		template<typename T>
+		void clamp_to_unit(exact_number<T>& x){
+			exact_number<T> minus_one = literals::one_exact<T>;
+			minus_one.positive = false;
+			if (x > literals::one_exact<T>)
+				x = literals::one_exact<T>;
+			else if (x < minus_one)
+				x = minus_one;
+		}
+
 		/**
 		 *  EXPONENT FUNCTION USING TAYLOR EXPANSION
 		 * @brief: calculates exponent of a exact_number using taylor expansion
 		 * @param: num: the exact number. whose exponent is to be found
-		 * @param: max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
+		 * @param: max_error_bits: Absolute Error in the result should be < 2^(-max_error_bits), see exact_number::error_bound
 		 * @param:  upper: if true: error lies in [0, +epsilon]
-		 *                  else: error lies in [-epsilon, 0], here epsilon = 1*base^(-max_error_exponent)
+		 *                  else: error lies in [-epsilon, 0], here epsilon = 2^(-max_error_bits)
+		 * @param:  mode: ABSOLUTE or RELATIVE, see PRECISION_MODE. In RELATIVE mode the series is summed
+		 *           up to the absolute precision which gives max_error_bits significant bits.
 		 * @author: Vikram Singh Chundawat
 		 **/
 		template<typename T>
-		exact_number<T> exponent(exact_number<T> num, size_t max_error_exponent, bool upper){
+		exact_number<T> exponent(exact_number<T> num, size_t max_error_bits, bool upper, PRECISION_MODE mode = PRECISION_MODE::ABSOLUTE){
+			size_t series_bits = (mode == PRECISION_MODE::RELATIVE) ? absolute_bits(max_error_bits, exponent_magnitude_bits(num)) : max_error_bits;
 			exact_number<T> result("1");
 			exact_number<T> term_number("1");
 			exact_number<T> factorial("1");
 			exact_number<T> cur_term("0");
-			exact_number<T> max_error(std::vector<T> {1}, -max_error_exponent, true);
+			exact_number<T> max_error = exact_number<T>::error_bound(series_bits);
 			exact_number<T> x_pow("1");
 			do{
 				result += cur_term;
@@ -30,9 +91,9 @@ namespace boost{
 				term_number = term_number + literals::one_exact<T>;
 				x_pow *= num;
 				cur_term = x_pow;
-				cur_term.divide_vector(factorial, max_error_exponent, upper);
+				cur_term.divide_vector_bits(factorial, series_bits, upper, PRECISION_MODE::ABSOLUTE);
 			}while(cur_term.abs() > max_error);
-			result = result.up_to(max_error_exponent, upper);
+			result = result.up_to_bits(max_error_bits, upper);
 			return result;
 		}
 
@@ -40,24 +101,27 @@ namespace boost{
 		 *  LOGARITHM(BASE e) FUNCTION USING TAYLOR EXPANSION
 		 * @brief: calculates log(base e) of a exact_number using taylor expansion
 		 * @param: x: the exact number. whose logarithm (ln(x)) is to be found
-		 * @param: max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
+		 * @param: max_error_bits: Absolute Error in the result should be < 2^(-max_error_bits), see exact_number::error_bound
 		 * @param:  upper: if true: error lies in [0, +epsilon]
-		 *                  else: error lies in [-epsilon, 0], here epsilon = 1*base^(-max_error_exponent)
+		 *                  else: error lies in [-epsilon, 0], here epsilon = 2^(-max_error_bits)
+		 * @param:  mode: ABSOLUTE or RELATIVE, see PRECISION_MODE. In RELATIVE mode the series is summed
+		 *           up to the absolute precision which gives max_error_bits significant bits.
 		 * @author: Vikram Singh Chundawat
 		 **/
 		template<typename T>
-		exact_number<T> logarithm(exact_number<T> x, size_t max_error_exponent, bool upper){
+		exact_number<T> logarithm(exact_number<T> x, size_t max_error_bits, bool upper, PRECISION_MODE mode = PRECISION_MODE::ABSOLUTE){
 			// log is only defined for numbers greater than 0
 			static const exact_number<T> two("2");
 			if(x == literals::zero_exact<T> || x.positive == false){
 				throw logarithm_not_defined_for_non_positive_number();
 			}
+			size_t series_bits = (mode == PRECISION_MODE::RELATIVE) ? absolute_bits(max_error_bits, logarithm_magnitude_bits(x)) : max_error_bits;
 			exact_number<T> result("0");
 			exact_number<T> term_number("1");
 			unsigned int term_number_int = 1;
 			exact_number<T> cur_term("0");
 			exact_number<T> x_pow ("1");
-			exact_number<T> max_error(std::vector<T> {1}, -max_error_exponent, true);
+			exact_number<T> max_error = exact_number<T>::error_bound(series_bits);
 			
 			if(x > literals::zero_exact<T> && x < two){
 				do{
@@ -67,7 +131,7 @@ namespace boost{
 						result += cur_term;	
 					x_pow = x_pow * (x - literals::one_exact<T>);
 					cur_term = x_pow;
-					cur_term.divide_vector(term_number, max_error_exponent, upper);
+					cur_term.divide_vector_bits(term_number, series_bits, upper, PRECISION_MODE::ABSOLUTE);
 					++term_number_int;
 					term_number = term_number + literals::one_exact<T>;
 				}while(cur_term.abs() > max_error);
@@ -77,13 +141,13 @@ namespace boost{
 			do{
 				result += cur_term;
 				x_pow = x_pow * (x - literals::one_exact<T>);
-				x_pow.divide_vector(x, max_error_exponent, upper);
+				x_pow.divide_vector_bits(x, series_bits, upper, PRECISION_MODE::ABSOLUTE);
 				cur_term = x_pow ;
-				cur_term.divide_vector(term_number, max_error_exponent, upper);
+				cur_term.divide_vector_bits(term_number, series_bits, upper, PRECISION_MODE::ABSOLUTE);
 				++term_number_int;
 				term_number = term_number + literals::one_exact<T>;
 			}while(cur_term.abs() > max_error);
-			result = result.up_to(max_error_exponent, upper);
+			result = result.up_to_bits(max_error_bits, upper);
 			return result;
 		}
 
@@ -91,13 +155,16 @@ namespace boost{
 		 *  SINE FUNCTION USING TAYLOR EXPANSION
 		 * @brief: calculates sin(x) of a exact_number using taylor expansion
 		 * @param: x: the exact_number, representing angle in radian
-		 * @param: max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
+		 * @param: max_error_bits: Absolute Error in the result should be < 2^(-max_error_bits), see exact_number::error_bound
 		 * @param:  upper: if true: error lies in [0, +epsilon]
-		 *                  else: error lies in [-epsilon, 0], here epsilon = 1*base^(-max_error_exponent)
+		 *                  else: error lies in [-epsilon, 0], here epsilon = 2^(-max_error_bits)
+		 * @param:  mode: ABSOLUTE or RELATIVE, see PRECISION_MODE. In RELATIVE mode the series is summed
+		 *           up to the absolute precision which gives max_error_bits significant bits.
 		 * @author: Vikram Singh Chundawat
 		 **/
 		template<typename T>
-		exact_number<T> sine(exact_number<T> x, size_t max_error_exponent, bool upper){
+		exact_number<T> sine(exact_number<T> x, size_t max_error_bits, bool upper, PRECISION_MODE mode = PRECISION_MODE::ABSOLUTE){
+			size_t series_bits = (mode == PRECISION_MODE::RELATIVE) ? absolute_bits(max_error_bits, sin_cos_magnitude_bits(x)) : max_error_bits;
 			exact_number<T> result("0");
 			exact_number<T> term_number("0");
 			unsigned int term_number_int = 0;
@@ -106,7 +173,7 @@ namespace boost{
 			exact_number<T> factorial("1");
 			exact_number<T> tmp;
 			exact_number<T> x_square = x*x;
-			exact_number<T> max_error(std::vector<T> {1}, -max_error_exponent, true);
+			exact_number<T> max_error = exact_number<T>::error_bound(series_bits);
 			static exact_number<T> two("2");
 			
 			do{
@@ -120,9 +187,10 @@ namespace boost{
 				x_pow *= x_square; // increasing power by two powers of original x
 				factorial = factorial * ( two * term_number) * ( (two * term_number) + literals::one_exact<T>); // increasing the values of factorial by two
 				cur_term  = x_pow;
-				cur_term.divide_vector(factorial, max_error_exponent, upper);
+				cur_term.divide_vector_bits(factorial, series_bits, upper, PRECISION_MODE::ABSOLUTE);
 			}while(cur_term.abs() > max_error);
-			result = result.up_to(max_error_exponent, upper);
+			result = result.up_to_bits(max_error_bits, upper);
+			clamp_to_unit(result);
 			return result;
 		}
 
@@ -130,13 +198,16 @@ namespace boost{
 		 *  COSINE FUNCTION USING TAYLOR EXPANSION
 		 * @brief: calculates cos(x) of a exact_number using taylor expansion
 		 * @param: x: the exact_number, representing angle in radian
-		 * @param: max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
+		 * @param: max_error_bits: Absolute Error in the result should be < 2^(-max_error_bits), see exact_number::error_bound
 		 * @param:  upper: if true: error lies in [0, +epsilon]
-		 *                  else: error lies in [-epsilon, 0], here epsilon = 1*base^(-max_error_exponent)
+		 *                  else: error lies in [-epsilon, 0], here epsilon = 2^(-max_error_bits)
+		 * @param:  mode: ABSOLUTE or RELATIVE, see PRECISION_MODE. In RELATIVE mode the series is summed
+		 *           up to the absolute precision which gives max_error_bits significant bits.
 		 * @author: Vikram Singh Chundawat
 		 **/
 		template<typename T>
-		exact_number<T> cosine(exact_number<T> x, size_t max_error_exponent, bool upper){
+		exact_number<T> cosine(exact_number<T> x, size_t max_error_bits, bool upper, PRECISION_MODE mode = PRECISION_MODE::ABSOLUTE){
+			size_t series_bits = (mode == PRECISION_MODE::RELATIVE) ? absolute_bits(max_error_bits, sin_cos_magnitude_bits(x)) : max_error_bits;
 			exact_number<T> result("1");
 			exact_number<T> cur_term("0");
 			exact_number<T> square_x = x*x;
@@ -144,7 +215,7 @@ namespace boost{
 			exact_number<T> factorial("1");
 			static exact_number<T> two("2");
 			exact_number<T> term_number("0");
-			exact_number<T> max_error(std::vector<T> {1}, -max_error_exponent, true);
+			exact_number<T> max_error = exact_number<T>::error_bound(series_bits);
 			int term_number_int = 0;
 			do{
 				if(term_number_int % 2 == 0)
@@ -157,12 +228,13 @@ namespace boost{
 				}
 				cur_power *= square_x;
 				cur_term = cur_power;
-				cur_term.divide_vector(factorial, max_error_exponent, upper);
+				cur_term.divide_vector_bits(factorial, series_bits, upper, PRECISION_MODE::ABSOLUTE);
 				++ term_number_int;
 				term_number = term_number + literals::one_exact<T>;
 				
 			}while(cur_term.abs() > max_error);
-			result = result.up_to(max_error_exponent, upper);
+			result = result.up_to_bits(max_error_bits, upper);
+			clamp_to_unit(result);
 			return result;
 		}
 
@@ -171,14 +243,17 @@ namespace boost{
 		 *  SINE AND COSINE FUNCTION USING TAYLOR EXPANSION
 		 * @brief: calculates cos(x) and sin(x) of a exact_number using taylor expansion
 		 * @param: x: the exact_number, representing angle in radian
-		 * @param: max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
+		 * @param: max_error_bits: Absolute Error in the result should be < 2^(-max_error_bits), see exact_number::error_bound
 		 * @param:  upper: if true: error lies in [0, +epsilon]
-		 *                  else: error lies in [-epsilon, 0], here epsilon = 1*base^(-max_error_exponent)
+		 *                  else: error lies in [-epsilon, 0], here epsilon = 2^(-max_error_bits)
 		 * @return: a tuple containing sin(x) and cos(x)
+		 * @param:  mode: ABSOLUTE or RELATIVE, see PRECISION_MODE. In RELATIVE mode the series is summed
+		 *           up to the absolute precision which gives max_error_bits significant bits.
 		 * @author: Vikram Singh Chundawat
 		 **/
 		template<typename T>
-		std::tuple<exact_number<T>, exact_number<T> > sin_cos(exact_number<T> x, size_t max_error_exponent, bool upper){
+		std::tuple<exact_number<T>, exact_number<T> > sin_cos(exact_number<T> x, size_t max_error_bits, bool upper, PRECISION_MODE mode = PRECISION_MODE::ABSOLUTE){
+			size_t series_bits = (mode == PRECISION_MODE::RELATIVE) ? absolute_bits(max_error_bits, sin_cos_magnitude_bits(x)) : max_error_bits;
 			exact_number<T> sin_result("0");
 			exact_number<T> cos_result("0");
 			exact_number<T> cur_sin_term = x;
@@ -188,7 +263,7 @@ namespace boost{
 			static exact_number<T> two("2");
 			exact_number<T> factorial_number("1");
 			unsigned int term_number_int = 0;
-			exact_number<T> max_error(std::vector<T> {1}, -max_error_exponent, true);
+			exact_number<T> max_error = exact_number<T>::error_bound(series_bits);
 			do{
 
 				if(term_number_int % 2 == 0){
@@ -204,15 +279,17 @@ namespace boost{
 				factorial *= factorial_number;
 				cur_power *= x;
 				cur_cos_term = cur_power;
-				cur_cos_term.divide_vector(factorial, max_error_exponent, upper);
+				cur_cos_term.divide_vector_bits(factorial, series_bits, upper, PRECISION_MODE::ABSOLUTE);
 
 				factorial_number = factorial_number + literals::one_exact<T>;
 				factorial *= factorial_number;
 				cur_power *= x;
 				cur_sin_term = cur_power;
-				cur_sin_term.divide_vector(factorial, max_error_exponent, upper);
+				cur_sin_term.divide_vector_bits(factorial, series_bits, upper, PRECISION_MODE::ABSOLUTE);
 			}while( (cur_cos_term.abs() > max_error) || (cur_sin_term.abs() > max_error) );
 
+			clamp_to_unit(sin_result);
+			clamp_to_unit(cos_result);
 			return std::make_tuple(sin_result, cos_result);
 		}
 
@@ -220,16 +297,17 @@ namespace boost{
 		 *  TANGENT FUNCTION USING TAYLOR EXPANSION
 		 * @brief: calculates tan(x) of a exact_number using taylor expansion
 		 * @param: x: the exact_number, representing angle in radian
-		 * @param: max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
+		 * @param: max_error_bits: Absolute Error in the result should be < 2^(-max_error_bits), see exact_number::error_bound
 		 * @param:  upper: if true: error lies in [0, +epsilon]
-		 *                  else: error lies in [-epsilon, 0], here epsilon = 1*base^(-max_error_exponent)
+		 *                  else: error lies in [-epsilon, 0], here epsilon = 2^(-max_error_bits)
+		 * @param:  mode: ABSOLUTE or RELATIVE, see PRECISION_MODE
 		 * @author: Vikram Singh Chundawat
 		 **/
 		template<typename T>
-		inline exact_number<T> tangent(exact_number<T> x, size_t max_error_exponent, bool upper){
-			auto [result, cos] = sin_cos(x, max_error_exponent, upper);
-			result.divide_vector(cos, max_error_exponent, upper);
-			result = result.up_to(max_error_exponent, upper);
+		inline exact_number<T> tangent(exact_number<T> x, size_t max_error_bits, bool upper, PRECISION_MODE mode = PRECISION_MODE::ABSOLUTE){
+			auto [result, cos] = sin_cos(x, max_error_bits, upper, mode);
+			result.divide_vector_bits(cos, max_error_bits, upper);
+			result = result.up_to_bits(max_error_bits, upper);
 			return result; 
 		}
 
@@ -237,16 +315,17 @@ namespace boost{
 		 *  COTANGENT FUNCTION USING TAYLOR EXPANSION
 		 * @brief: calculates cot(x) of a exact_number using taylor expansion
 		 * @param: x: the exact_number, representing angle in radian
-		 * @param: max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
+		 * @param: max_error_bits: Absolute Error in the result should be < 2^(-max_error_bits), see exact_number::error_bound
 		 * @param:  upper: if true: error lies in [0, +epsilon]
-		 *                  else: error lies in [-epsilon, 0], here epsilon = 1*base^(-max_error_exponent)
+		 *                  else: error lies in [-epsilon, 0], here epsilon = 2^(-max_error_bits)
+		 * @param:  mode: ABSOLUTE or RELATIVE, see PRECISION_MODE
 		 * @author: Vikram Singh Chundawat
 		 **/
 		template<typename T>
-		inline exact_number<T> cotangent(exact_number<T> x, size_t max_error_exponent, bool upper){
-			auto [sin, result] = sin_cos(x, max_error_exponent, upper);
-			result.divide_vector(sin, max_error_exponent, upper);
-			result = result.up_to(max_error_exponent, upper);
+		inline exact_number<T> cotangent(exact_number<T> x, size_t max_error_bits, bool upper, PRECISION_MODE mode = PRECISION_MODE::ABSOLUTE){
+			auto [sin, result] = sin_cos(x, max_error_bits, upper, mode);
+			result.divide_vector_bits(sin, max_error_bits, upper);
+			result = result.up_to_bits(max_error_bits, upper);
 			return result; 
 		}
 
@@ -254,17 +333,18 @@ namespace boost{
 		 *  SECANT FUNCTION USING TAYLOR EXPANSION
 		 * @brief: calculates sec(x) of a exact_number using taylor expansion
 		 * @param: x: the exact_number, representing angle in radian
-		 * @param: max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
+		 * @param: max_error_bits: Absolute Error in the result should be < 2^(-max_error_bits), see exact_number::error_bound
 		 * @param:  upper: if true: error lies in [0, +epsilon]
-		 *                  else: error lies in [-epsilon, 0], here epsilon = 1*base^(-max_error_exponent)
+		 *                  else: error lies in [-epsilon, 0], here epsilon = 2^(-max_error_bits)
+		 * @param:  mode: ABSOLUTE or RELATIVE, see PRECISION_MODE
 		 * @author: Vikram Singh Chundawat
 		 **/
 		template<typename T>
-		inline exact_number<T> secant(exact_number<T> x, size_t max_error_exponent, bool upper){
+		inline exact_number<T> secant(exact_number<T> x, size_t max_error_bits, bool upper, PRECISION_MODE mode = PRECISION_MODE::ABSOLUTE){
 			exact_number<T> result("1");
-			exact_number<T> cos = cosine(x, max_error_exponent, upper);
-			result.divide_vector(cos, max_error_exponent, upper);
-			result = result.up_to(max_error_exponent, upper);
+			exact_number<T> cos = cosine(x, max_error_bits, upper, mode);
+			result.divide_vector_bits(cos, max_error_bits, upper);
+			result = result.up_to_bits(max_error_bits, upper);
 			return result;
 		}
 
@@ -272,20 +352,67 @@ namespace boost{
 		 *  COSECANT FUNCTION USING TAYLOR EXPANSION
 		 * @brief: calculates cosec(x) of a exact_number using taylor expansion
 		 * @param: x: the exact_number, representing angle in radian
-		 * @param: max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
+		 * @param: max_error_bits: Absolute Error in the result should be < 2^(-max_error_bits), see exact_number::error_bound
 		 * @param:  upper: if true: error lies in [0, +epsilon]
-		 *                  else: error lies in [-epsilon, 0], here epsilon = 1*base^(-max_error_exponent)
+		 *                  else: error lies in [-epsilon, 0], here epsilon = 2^(-max_error_bits)
+		 * @param:  mode: ABSOLUTE or RELATIVE, see PRECISION_MODE
 		 * @author: Vikram Singh Chundawat
 		 **/
 		template<typename T>
-		inline exact_number<T> cosecant(exact_number<T> x, size_t max_error_exponent, bool upper){
+		inline exact_number<T> cosecant(exact_number<T> x, size_t max_error_bits, bool upper, PRECISION_MODE mode = PRECISION_MODE::ABSOLUTE){
 			exact_number<T> result("1");
-			exact_number<T> sin = sine(x, max_error_exponent, upper);
-			result.divide_vector(sin, max_error_exponent, upper);
-			result = result.up_to(max_error_exponent, upper);
+			exact_number<T> sin = sine(x, max_error_bits, upper, mode);
+			result.divide_vector_bits(sin, max_error_bits, upper);
+			result = result.up_to_bits(max_error_bits, upper);
 			return result;
 		}
 
+		/**
+		 *  SQUARE ROOT USING NEWTON ITERATION
+		 * @brief: calculates sqrt(x) of a non negative exact_number. Newton iterations started above
+		 *         the root stay above it when the quotients are rounded up, so the last one is an upper
+		 *         bound and x divided by it, rounded down, is a lower bound.
+		 * @param: x: the exact_number whose square root is to be found
+		 * @param: max_error_bits: Relative Error in the result should be < 2^(-max_error_bits)
+		 * @param:  upper: if true: error lies in [0, +epsilon]
+		 *                  else: error lies in [-epsilon, 0]
+		 **/
+		template<typename T>
+		exact_number<T> square_root(exact_number<T> x, size_t max_error_bits, bool upper){
+			if (x == literals::zero_exact<T>)
+				return literals::zero_exact<T>;
+			if (!x.positive)
+				throw square_root_not_defined_for_negative_number();
+
+			T base = (std::numeric_limits<T>::max() / 4) * 2 - 1;
+			exact_number<T> half;
+			half.digits = {base / 2 + 1};
+
+			// x < (base + 1)^exponent, so (base + 1)^ceil(exponent / 2) is above its root
+			x.normalize();
+			int half_exponent = x.exponent >= 0 ? (x.exponent + 1) / 2 : -(-x.exponent / 2);
+			exact_number<T> root(std::vector<T> {1}, half_exponent + 1);
+
+			// the first iterations only approach the root, they are done at a low precision
+			size_t working_bits = max_error_bits + exact_number<T>::BITS_PER_DIGIT;
+			for (size_t bits : {std::min<size_t>(working_bits, 2 * exact_number<T>::BITS_PER_DIGIT), working_bits}) {
+				while (true) {
+					exact_number<T> quotient = x;
+					quotient.divide_vector_bits(root, bits, true);
+					exact_number<T> next = ((root + quotient) * half).up_to_bits(bits, true);
+					if (!(next < root))
+						break;
+					root = next;
+				}
+			}
+
+			if (upper)
+				return root.up_to_bits(max_error_bits, true);
+			exact_number<T> result = x;
+			result.divide_vector_bits(root, working_bits, false);
+			return result.up_to_bits(max_error_bits, false);
+		}
+
 	}
 }
 
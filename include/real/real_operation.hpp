@@ -2,9 +2,11 @@
 #define BOOST_REAL_REAL_OPERATION
 
 #include <memory> // shared_ptr
+#include <vector>
 
 #include <real/real_algorithm.hpp>
 #include <real/real_explicit.hpp>
+#include <real/real_function.hpp>
 
 namespace boost{
     namespace real{
@@ -21,7 +23,7 @@ namespace boost{
         * 
         * @warning due to the recursive nature of real_operation, destruction may cause stack overflow
         */
-        enum class OPERATION{ADDITION, SUBTRACTION, MULTIPLICATION, DIVISION, INTEGER_POWER, EXPONENT, LOGARITHM, SIN, COS, TAN, COT, SEC, COSEC}; 
+        enum class OPERATION{ADDITION, SUBTRACTION, MULTIPLICATION, DIVISION, INTEGER_POWER, EXPONENT, LOGARITHM, SIN, COS, TAN, COT, SEC, COSEC, POLYNOMIAL, FUNCTION}; 
 
         template <typename T = int>
         class real_operation{
@@ -29,6 +31,10 @@ namespace boost{
             std::shared_ptr<real_data<T>> _lhs;
             std::shared_ptr<real_data<T>> _rhs;
             OPERATION _operation;
+            // the coefficients of a POLYNOMIAL, the one of x^k at index k
+            std::vector<std::shared_ptr<real_data<T>>> _coefficients;
+            // the user defined function of a FUNCTION
+            std::shared_ptr<const real_function<T>> _function;
 
         public:
 
@@ -40,6 +46,22 @@ namespace boost{
              */
             real_operation(std::shared_ptr<real_data<T>> &lhs, std::shared_ptr<real_data<T>> &rhs, OPERATION op) : _lhs(lhs), _rhs(rhs), _operation(op) {};
 
+            /*
+             * @brief Constructor of the POLYNOMIAL operation, both operands are the argument
+             * @param x - the polynomial argument
+             * @param coefficients - the coefficients, the one of x^k at index k
+             */
+            real_operation(std::shared_ptr<real_data<T>> &x, std::vector<std::shared_ptr<real_data<T>>> coefficients)
+                : _lhs(x), _rhs(x), _operation(OPERATION::POLYNOMIAL), _coefficients(std::move(coefficients)) {};
+
+            /*
+             * @brief Constructor of the FUNCTION operation, both operands are the argument
+             * @param x - the function argument
+             * @param function - the user defined function
+             */
+            real_operation(std::shared_ptr<real_data<T>> &x, std::shared_ptr<const real_function<T>> function)
+                : _lhs(x), _rhs(x), _operation(OPERATION::FUNCTION), _function(std::move(function)) {};
+
             OPERATION get_operation() const {
                 return _operation;
             }
@@ -57,6 +79,16 @@ namespace boost{
             std::shared_ptr<real_data<T>> lhs() const {
                 return _lhs;
             }
+
+            /// the coefficients of a POLYNOMIAL, empty for the other operations
+            const std::vector<std::shared_ptr<real_data<T>>>& coefficients() const {
+                return _coefficients;
+            }
+
+            /// the user defined function of a FUNCTION, null for the other operations
+            const real_function<T>* function() const {
+                return _function.get();
+            }
         };
     }
 }
@@ -0,0 +1,251 @@
+#ifndef BOOST_REAL_REAL_VECTOR_HPP
+#define BOOST_REAL_REAL_VECTOR_HPP
+
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <real/real.hpp>
+#include <real/interval_arithmetic.hpp>
+
+namespace boost {
+    namespace real {
+
+        /**
+         * @brief A column of boost::real::real numbers, and the expressions on columns.
+         *
+         * The operators on real_vector numbers build a single expression tree for all the rows,
+         * whose leaves are the columns. evaluate() runs every operation as a loop over the rows,
+         * on their approximation intervals at a common precision in bits, and evaluates again at
+         * a higher precision only the rows whose result is not tight enough. A column of one number
+         * is broadcast to the size of the other operand.
+         *
+         * Rows are independent lazy numbers too, operator[] returns the expression of a row as a
+         * boost::real::real number.
+         */
+        template <typename T = int>
+        class real_vector {
+            struct node {
+                OPERATION operation = OPERATION::ADDITION;
+                std::shared_ptr<const node> lhs;
+                std::shared_ptr<const node> rhs;
+                // the numbers of a leaf, which has no operands
+                std::vector<real<T>> column;
+                size_t size = 0;
+            };
+
+            std::shared_ptr<const node> _node;
+
+            real_vector(OPERATION operation, const real_vector& lhs, const real_vector& rhs) {
+                if (lhs.size() != rhs.size() && lhs.size() != 1 && rhs.size() != 1) {
+                    throw real_vector_size_mismatch_exception();
+                }
+                auto result = std::make_shared<node>();
+                result->operation = operation;
+                result->lhs = lhs._node;
+                result->rhs = rhs._node;
+                result->size = lhs.size() == 1 ? rhs.size() : lhs.size();
+                _node = result;
+            }
+
+            /// the nodes of the tree, operands first, each node once
+            static void sort_nodes(const node* n, std::vector<const node*>& nodes,
+                                   std::unordered_map<const node*, size_t>& indices) {
+                if (indices.count(n) != 0) {
+                    return;
+                }
+                if (n->lhs) {
+                    sort_nodes(n->lhs.get(), nodes, indices);
+                    sort_nodes(n->rhs.get(), nodes, indices);
+                }
+                indices[n] = nodes.size();
+                nodes.push_back(n);
+            }
+
+            static real<T> row(const node* n, size_t i) {
+                size_t index = n->size == 1 ? 0 : i;
+                if (!n->lhs) {
+                    return n->column[index];
+                }
+                real<T> lhs = row(n->lhs.get(), index);
+                real<T> rhs = row(n->rhs.get(), index);
+                switch (n->operation) {
+                    case OPERATION::ADDITION:
+                        return lhs + rhs;
+                    case OPERATION::SUBTRACTION:
+                        return lhs - rhs;
+                    case OPERATION::MULTIPLICATION:
+                        return lhs * rhs;
+                    default:
+                        return lhs / rhs;
+                }
+            }
+
+        public:
+
+            /// constructs a column of the given numbers
+            real_vector(std::vector<real<T>> column) {
+                auto leaf = std::make_shared<node>();
+                leaf->size = column.size();
+                leaf->column = std::move(column);
+                _node = leaf;
+            }
+
+            /// constructs a column of one number, which is broadcast by the operators
+            real_vector(const real<T>& number) : real_vector(std::vector<real<T>> {number}) {}
+
+            /// the amount of rows
+            size_t size() const {
+                return _node->size;
+            }
+
+            /// the expression of the i-th row, as a boost::real::real number
+            real<T> operator[](size_t i) const {
+                return row(_node.get(), i);
+            }
+
+            /**
+             * @brief Evaluates every row to an interval whose width is at most about 2^-bits times its
+             * magnitude, or 2^-bits for rows lower than one.
+             *
+             * The leaves are refined column by column and every operation is computed for all the
+             * rows with the outward rounded interval arithmetic at a working precision a digit above
+             * bits. The rows which are not tight enough, or whose divisor interval contains zero,
+             * are evaluated again at twice the working precision, the others are left as they are.
+             *
+             * @throws boost::real::divergent_division_result_exception if a divisor interval still
+             * contains zero at the maximum precision of the leaves.
+             * @throws boost::real::precision_exception if a row is not tight enough at the maximum
+             * precision of the leaves.
+             */
+            std::vector<interval<T>> evaluate(size_t bits) const {
+                std::vector<const node*> nodes;
+                std::unordered_map<const node*, size_t> indices;
+                sort_nodes(_node.get(), nodes, indices);
+
+                // struct of arrays: the iterators of every leaf and the intervals of every node
+                std::vector<std::vector<const_precision_iterator<T>>> iterators(nodes.size());
+                std::vector<std::vector<interval<T>>> values(nodes.size());
+                size_t maximum_bits = std::numeric_limits<size_t>::max();
+                for (size_t k = 0; k < nodes.size(); k++) {
+                    values[k].resize(nodes[k]->size);
+                    for (const real<T>& number : nodes[k]->column) {
+                        iterators[k].push_back(number.get_real_itr());
+                        maximum_bits = std::min(maximum_bits,
+                            (size_t) iterators[k].back().maximum_precision() * exact_number<T>::BITS_PER_DIGIT);
+                    }
+                }
+
+                size_t rows = size();
+                std::vector<size_t> active(rows);
+                for (size_t i = 0; i < rows; i++) {
+                    active[i] = i;
+                }
+                // the rows whose value is unbounded at the current precision
+                std::vector<char> divergent(rows);
+                size_t working_bits = std::min(bits + exact_number<T>::BITS_PER_DIGIT, maximum_bits);
+
+                while (true) {
+                    for (size_t k = 0; k < nodes.size(); k++) {
+                        const node* n = nodes[k];
+                        // a broadcast node is evaluated once for all the rows
+                        size_t count = n->size == 1 ? 1 : active.size();
+
+                        if (!n->lhs) {
+                            for (size_t a = 0; a < count; a++) {
+                                size_t i = n->size == 1 ? 0 : active[a];
+                                iterators[k][i].refine_to_bits(working_bits);
+                                values[k][i] = iterators[k][i].get_interval();
+                            }
+                            continue;
+                        }
+
+                        const std::vector<interval<T>>& lhs = values[indices[n->lhs.get()]];
+                        const std::vector<interval<T>>& rhs = values[indices[n->rhs.get()]];
+                        bool lhs_broadcast = n->lhs->size == 1;
+                        bool rhs_broadcast = n->rhs->size == 1;
+                        for (size_t a = 0; a < count; a++) {
+                            size_t i = n->size == 1 ? 0 : active[a];
+                            if (n->size != 1 && divergent[i]) {
+                                continue;
+                            }
+                            const interval<T>& x = lhs[lhs_broadcast ? 0 : i];
+                            const interval<T>& y = rhs[rhs_broadcast ? 0 : i];
+                            switch (n->operation) {
+                                case OPERATION::ADDITION:
+                                    values[k][i] = add(x, y, working_bits);
+                                    break;
+                                case OPERATION::SUBTRACTION:
+                                    values[k][i] = sub(x, y, working_bits);
+                                    break;
+                                case OPERATION::MULTIPLICATION:
+                                    values[k][i] = mul(x, y, working_bits);
+                                    break;
+                                default:
+                                    if ((!y.positive() && !y.negative()) || y.lower_bound == literals::zero_exact<T> ||
+                                        y.upper_bound == literals::zero_exact<T>) {
+                                        if (n->size == 1) {
+                                            for (size_t j : active) {
+                                                divergent[j] = 1;
+                                            }
+                                        } else {
+                                            divergent[i] = 1;
+                                        }
+                                    } else {
+                                        values[k][i] = div(x, y, working_bits);
+                                    }
+                            }
+                        }
+                    }
+
+                    const std::vector<interval<T>>& result = values.back();
+                    std::vector<size_t> pending;
+                    bool unbounded = false;
+                    for (size_t i : active) {
+                        if (divergent[i]) {
+                            unbounded = true;
+                            pending.push_back(i);
+                        } else if (!result[i].tight(bits)) {
+                            pending.push_back(i);
+                        }
+                    }
+                    if (pending.empty()) {
+                        break;
+                    }
+                    if (working_bits >= maximum_bits) {
+                        if (unbounded) {
+                            throw divergent_division_result_exception();
+                        }
+                        throw precision_exception();
+                    }
+                    for (size_t i : pending) {
+                        divergent[i] = 0;
+                    }
+                    active.swap(pending);
+                    working_bits = std::min(2 * working_bits, maximum_bits);
+                }
+
+                return values.back();
+            }
+
+            friend real_vector operator+(const real_vector& lhs, const real_vector& rhs) {
+                return real_vector(OPERATION::ADDITION, lhs, rhs);
+            }
+
+            friend real_vector operator-(const real_vector& lhs, const real_vector& rhs) {
+                return real_vector(OPERATION::SUBTRACTION, lhs, rhs);
+            }
+
+            friend real_vector operator*(const real_vector& lhs, const real_vector& rhs) {
+                return real_vector(OPERATION::MULTIPLICATION, lhs, rhs);
+            }
+
+            friend real_vector operator/(const real_vector& lhs, const real_vector& rhs) {
+                return real_vector(OPERATION::DIVISION, lhs, rhs);
+            }
+        };
+    }
+}
+
+#endif // BOOST_REAL_REAL_VECTOR_HPP
@@ -0,0 +1,503 @@
+#ifndef BOOST_REAL_SIMPLIFICATION_HPP
+#define BOOST_REAL_SIMPLIFICATION_HPP
+
+#include <algorithm>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <real/node_table.hpp>
+#include <real/real_data.hpp>
+
+namespace boost {
+    namespace real {
+
+        /**
+         * @brief A rewrite pass over the operation DAG of a number, see boost::real::real::simplify.
+         *
+         * The pass is bottom-up: the operands of a node are simplified first, then the rules of the
+         * rule table are tried on the node, in order, until none applies. Equal subtrees are
+         * merged into a single node during the pass, and explicit leaves with the same value too,
+         * so a rule that looks for a repeated operand only has to compare pointers. Nodes which
+         * are not rewritten are kept, with the approximation they already reached.
+         */
+        template <typename T = int>
+        class simplifier {
+            using node = std::shared_ptr<real_data<T>>;
+
+            /**
+             * @brief A rewrite rule: it receives an operation and its simplified operands and
+             * returns the rewritten node, or nullptr if it does not apply. Rules build their result
+             * with make(), so the result is simplified as well.
+             */
+            using rule = node (simplifier::*)(OPERATION op, const node& lhs, const node& rhs);
+
+            // chains with more terms than this are not flattened, as a DAG may expand exponentially
+            static constexpr size_t MAXIMUM_TERMS = 4096;
+            // sums with more terms than this are not searched for common factors
+            static constexpr size_t MAXIMUM_FACTORED_TERMS = 64;
+
+            std::unordered_map<const real_data<T>*, node> _simplified;
+            std::map<std::tuple<OPERATION, const real_data<T>*, const real_data<T>*>, node> _operations;
+            std::map<std::tuple<std::vector<T>, int, bool>, node> _constants;
+
+        public:
+
+            /// returns the simplified version of x, which is x itself if no rule applies
+            node simplify(const node& x) {
+                auto it = _simplified.find(x.get());
+                if (it != _simplified.end()) {
+                    return it->second;
+                }
+
+                if (x->input()) {
+                    return x;
+                }
+
+                node result = std::visit(overloaded {
+                    [this, &x] (const real_explicit<T>& real) {
+                        return this->intern_constant(x, real.get_exact_number());
+                    },
+                    [this, &x] (const real_operation<T>& real) {
+                        // the rules do not apply to polynomials, whose node already avoids the dependency
+                        if (real.get_operation() == OPERATION::POLYNOMIAL || real.get_operation() == OPERATION::FUNCTION) {
+                            return x;
+                        }
+                        node lhs = this->simplify(real.lhs());
+                        node rhs = this->simplify(real.rhs());
+                        return this->make(real.get_operation(), lhs, rhs, x);
+                    },
+                    [&x] (const auto&) {
+                        return x;
+                    }
+                }, x->get_real_number());
+
+                _simplified[x.get()] = result;
+                return result;
+            }
+
+        private:
+
+            node intern_constant(const node& x, const exact_number<T>& value) {
+                auto key = std::make_tuple(value.digits, value.exponent, value.positive);
+                auto it = _constants.find(key);
+                if (it != _constants.end()) {
+                    return it->second;
+                }
+                _constants[key] = x;
+                return x;
+            }
+
+            node constant(exact_number<T> value) {
+                value.normalize();
+                if (value.digits.empty()) {
+                    value = exact_number<T>(std::vector<T> {0}, 0);
+                }
+                return intern_constant(node_table<T>::make(real_explicit<T>(value)), value);
+            }
+
+            node constant(int value) {
+                if (value == 0) {
+                    return constant(exact_number<T>(std::vector<T> {0}, 0));
+                }
+                return constant(exact_number<T>(std::vector<T> {(T) std::abs(value)}, 1, value > 0));
+            }
+
+            /**
+             * @brief Returns the node for lhs op rhs: an equal node built before, the result of the
+             * first rule that applies, or a new node. original, if given, is returned when its
+             * operands did not change, so it keeps its approximation.
+             */
+            node make(OPERATION op, const node& lhs, const node& rhs, const node& original = nullptr) {
+                auto key = std::make_tuple(op, lhs.get(), rhs.get());
+                auto it = _operations.find(key);
+                if (it != _operations.end()) {
+                    return it->second;
+                }
+
+                // the rule table, tried in order
+                static const rule rules[] = {
+                    &simplifier::identity_elements,
+                    &simplifier::self_cancellation,
+                    &simplifier::constant_folding,
+                    &simplifier::sum_normalization,
+                    &simplifier::product_normalization,
+                };
+
+                node result;
+                for (rule r : rules) {
+                    result = (this->*r)(op, lhs, rhs);
+                    if (result) {
+                        break;
+                    }
+                }
+
+                if (!result) {
+                    const real_operation<T>* original_operation =
+                        original ? std::get_if<real_operation<T>>(original->get_real_ptr()) : nullptr;
+                    if (original_operation != nullptr && same(original_operation->lhs(), lhs) && same(original_operation->rhs(), rhs)) {
+                        result = original;
+                    } else {
+                        node operand_lhs = lhs, operand_rhs = rhs;
+                        result = node_table<T>::make(real_operation<T>(operand_lhs, operand_rhs, op));
+                    }
+                }
+                _operations[key] = result;
+                return result;
+            }
+
+            /// true if the operand x was simplified to y, or to an equal constant leaf
+            static bool same(const node& x, const node& y) {
+                if (x == y) {
+                    return true;
+                }
+                std::optional<exact_number<T>> a = constant_value(x);
+                std::optional<exact_number<T>> b = constant_value(y);
+                return a && b && *a == *b;
+            }
+
+            /// the value of an explicit leaf
+            static std::optional<exact_number<T>> constant_value(const node& x) {
+                if (x->reactive()) {
+                    return std::nullopt;
+                }
+                if (auto leaf = std::get_if<real_explicit<T>>(x->get_real_ptr())) {
+                    return leaf->get_exact_number();
+                }
+                return std::nullopt;
+            }
+
+            static bool is_zero(const node& x) {
+                if (x->reactive()) {
+                    return false;
+                }
+                if (auto rational = std::get_if<real_rational<T>>(x->get_real_ptr())) {
+                    return rational->a == literals::zero_integer<T>;
+                }
+                std::optional<exact_number<T>> value = constant_value(x);
+                return value && std::all_of(value->digits.begin(), value->digits.end(), [] (T digit) {
+                    return digit == 0;
+                });
+            }
+
+            static bool is_one(const node& x) {
+                if (x->reactive()) {
+                    return false;
+                }
+                if (auto rational = std::get_if<real_rational<T>>(x->get_real_ptr())) {
+                    return rational->a == rational->b;
+                }
+                std::optional<exact_number<T>> value = constant_value(x);
+                return value && *value == literals::one_exact<T>;
+            }
+
+            /// true if x is an explicit or rational leaf, whose value is always defined
+            static bool is_constant(const node& x) {
+                if (x->reactive()) {
+                    return false;
+                }
+                return std::holds_alternative<real_explicit<T>>(*x->get_real_ptr()) ||
+                       std::holds_alternative<real_rational<T>>(*x->get_real_ptr());
+            }
+
+            /**
+             * @brief true if x can be dropped from a product by zero or raised to zero, which is when
+             * it is known to be defined. Otherwise the rewrite would hide the domain error or the
+             * divergence the evaluation of x throws.
+             */
+            static bool is_defined(const node& x) {
+                return is_constant(x) || is_nonzero(x);
+            }
+
+            /// true if x is certainly not zero, without evaluating its digits
+            static bool is_nonzero(const node& x) {
+                if (x->reactive()) {
+                    return false;
+                }
+                const double_interval& enclosure = x->double_enclosure();
+                return enclosure.positive() || enclosure.negative();
+            }
+
+            static const real_operation<T>* as_operation(const node& x, OPERATION op) {
+                auto operation = std::get_if<real_operation<T>>(x->get_real_ptr());
+                if (operation != nullptr && operation->get_operation() == op && !x->input()) {
+                    return operation;
+                }
+                return nullptr;
+            }
+
+            /// x + 0, 0 + x, x - 0, x * 1, 1 * x, x / 1, x ^ 1 -> x and x * 0, 0 * x -> 0, x ^ 0 -> 1 if x is defined
+            node identity_elements(OPERATION op, const node& lhs, const node& rhs) {
+                switch (op) {
+                    case OPERATION::ADDITION:
+                        if (is_zero(lhs)) {
+                            return rhs;
+                        }
+                        [[fallthrough]];
+                    case OPERATION::SUBTRACTION:
+                        return is_zero(rhs) ? lhs : nullptr;
+                    case OPERATION::MULTIPLICATION:
+                        if ((is_zero(lhs) && is_defined(rhs)) || (is_zero(rhs) && is_defined(lhs))) {
+                            return constant(0);
+                        }
+                        if (is_one(lhs)) {
+                            return rhs;
+                        }
+                        return is_one(rhs) ? lhs : nullptr;
+                    case OPERATION::DIVISION:
+                        return is_one(rhs) ? lhs : nullptr;
+                    case OPERATION::INTEGER_POWER:
+                        if (is_zero(rhs) && is_defined(lhs)) {
+                            return constant(1);
+                        }
+                        return is_one(rhs) ? lhs : nullptr;
+                    default:
+                        return nullptr;
+                }
+            }
+
+            /// x - x -> 0 if x is defined, and x / x -> 1, 0 / x -> 0 if x is not zero
+            node self_cancellation(OPERATION op, const node& lhs, const node& rhs) {
+                if (op == OPERATION::SUBTRACTION && lhs == rhs && is_defined(lhs)) {
+                    return constant(0);
+                }
+                if (op == OPERATION::DIVISION && (lhs == rhs || is_zero(lhs)) && is_nonzero(rhs)) {
+                    return constant(lhs == rhs ? 1 : 0);
+                }
+                return nullptr;
+            }
+
+            /// sums, differences and products of explicit leaves are computed exactly
+            node constant_folding(OPERATION op, const node& lhs, const node& rhs) {
+                std::optional<exact_number<T>> a = constant_value(lhs);
+                std::optional<exact_number<T>> b = constant_value(rhs);
+                if (!a || !b) {
+                    return nullptr;
+                }
+                switch (op) {
+                    case OPERATION::ADDITION:
+                        return constant(*a + *b);
+                    case OPERATION::SUBTRACTION:
+                        return constant(*a - *b);
+                    case OPERATION::MULTIPLICATION:
+                        return constant(*a * *b);
+                    default:
+                        return nullptr;
+                }
+            }
+
+            /// collects the terms of a chain of additions and subtractions, with their signs
+            static bool flatten_sum(const node& x, bool positive, std::vector<std::pair<node, bool>>& terms, size_t depth, size_t& max_depth) {
+                max_depth = std::max(max_depth, depth);
+                const real_operation<T>* sum = as_operation(x, OPERATION::ADDITION);
+                const real_operation<T>* difference = as_operation(x, OPERATION::SUBTRACTION);
+                if (sum == nullptr && difference == nullptr) {
+                    terms.push_back({x, positive});
+                    return terms.size() <= MAXIMUM_TERMS;
+                }
+                const real_operation<T>* operation = sum != nullptr ? sum : difference;
+                return flatten_sum(operation->lhs(), positive, terms, depth + 1, max_depth) &&
+                       flatten_sum(operation->rhs(), sum != nullptr ? positive : !positive, terms, depth + 1, max_depth);
+            }
+
+            /// builds a balanced sum of the nodes, or nullptr if there are none
+            node balanced(OPERATION op, const std::vector<node>& nodes, size_t begin, size_t end) {
+                if (begin == end) {
+                    return nullptr;
+                }
+                if (end - begin == 1) {
+                    return nodes[begin];
+                }
+                size_t middle = begin + (end - begin) / 2;
+                return make(op, balanced(op, nodes, begin, middle), balanced(op, nodes, middle, end));
+            }
+
+            /// the depth of a balanced tree with n leaves
+            static size_t balanced_depth(size_t n) {
+                size_t depth = 0;
+                while (((size_t) 1 << depth) < n) {
+                    ++depth;
+                }
+                return depth;
+            }
+
+            /// the ways to write x as factor * cofactor: the operands of a product, or x * 1
+            std::vector<std::pair<node, node>> factorizations(const node& x) {
+                const real_operation<T>* product = as_operation(x, OPERATION::MULTIPLICATION);
+                if (product == nullptr) {
+                    return {{x, constant(1)}};
+                }
+                return {{product->lhs(), product->rhs()}, {product->rhs(), product->lhs()}};
+            }
+
+            /**
+             * @brief Normalizes a chain of additions and subtractions: the constant terms are
+             * merged, terms repeated k times become k * x, opposite defined terms cancel,
+             * x * a +- x * b and x * a +- x become (a +- b) * x and (a +- 1) * x, and long chains
+             * are rebuilt balanced, as sum of the positive terms minus sum of the negative ones.
+             */
+            node sum_normalization(OPERATION op, const node& lhs, const node& rhs) {
+                if (op != OPERATION::ADDITION && op != OPERATION::SUBTRACTION) {
+                    return nullptr;
+                }
+                std::vector<std::pair<node, bool>> terms;
+                size_t depth = 0;
+                if (!flatten_sum(lhs, true, terms, 1, depth) ||
+                    !flatten_sum(rhs, op == OPERATION::ADDITION, terms, 1, depth)) {
+                    return nullptr;
+                }
+                bool changed = terms.size() >= 4 && depth > balanced_depth(terms.size()) + 1;
+
+                // constants and repeated terms
+                exact_number<T> constant_sum = literals::zero_exact<T>;
+                size_t constants = 0;
+                std::vector<node> order;
+                std::unordered_map<const real_data<T>*, int> coefficients;
+                std::unordered_map<const real_data<T>*, size_t> occurrences;
+                for (auto& [term, positive] : terms) {
+                    std::optional<exact_number<T>> value = constant_value(term);
+                    if (value) {
+                        constant_sum = positive ? constant_sum + *value : constant_sum - *value;
+                        ++constants;
+                        continue;
+                    }
+                    if (coefficients.count(term.get()) == 0) {
+                        order.push_back(term);
+                    }
+                    coefficients[term.get()] += positive ? 1 : -1;
+                    ++occurrences[term.get()];
+                }
+                changed = changed || constants > 1;
+
+                // opposite terms only cancel if they are defined, otherwise x - x is kept
+                std::vector<std::pair<node, bool>> result;
+                for (const node& term : order) {
+                    int coefficient = coefficients[term.get()];
+                    size_t kept = 1;
+                    if (coefficient == 1 || coefficient == -1) {
+                        result.push_back({term, coefficient > 0});
+                    } else if (coefficient != 0) {
+                        result.push_back({make(OPERATION::MULTIPLICATION, constant(std::abs(coefficient)), term), coefficient > 0});
+                    } else if (!is_defined(term)) {
+                        result.push_back({term, true});
+                        result.push_back({term, false});
+                        kept = 2;
+                    } else {
+                        kept = 0;
+                    }
+                    changed = changed || occurrences[term.get()] != kept;
+                }
+
+                // common factors, x * a +- x * b -> (a +- b) * x, where a bare term x is x * 1
+                if (result.size() <= MAXIMUM_FACTORED_TERMS) {
+                    for (size_t i = 0; i < result.size(); ++i) {
+                        for (size_t j = i + 1; j < result.size(); ++j) {
+                            if (result[i].first == result[j].first) { // a kept x - x
+                                continue;
+                            }
+                            node a, b, x;
+                            bool found = false;
+                            for (auto& [first_factor, first_cofactor] : factorizations(result[i].first)) {
+                                for (auto& [second_factor, second_cofactor] : factorizations(result[j].first)) {
+                                    if (!found && first_factor == second_factor) {
+                                        x = first_factor; a = first_cofactor; b = second_cofactor;
+                                        found = true;
+                                    }
+                                }
+                            }
+                            if (!found) {
+                                continue;
+                            }
+                            OPERATION combine = result[i].second == result[j].second ? OPERATION::ADDITION : OPERATION::SUBTRACTION;
+                            result[i].first = make(OPERATION::MULTIPLICATION, make(combine, a, b), x);
+                            result.erase(result.begin() + j);
+                            changed = true;
+                            j = i;
+                        }
+                    }
+                }
+
+                if (!changed) {
+                    return nullptr;
+                }
+
+                std::vector<node> positive_terms, negative_terms;
+                if (constant_sum != literals::zero_exact<T> || result.empty()) {
+                    positive_terms.push_back(constant(constant_sum));
+                }
+                for (auto& [term, positive] : result) {
+                    (positive ? positive_terms : negative_terms).push_back(term);
+                }
+                node positive_sum = balanced(OPERATION::ADDITION, positive_terms, 0, positive_terms.size());
+                node negative_sum = balanced(OPERATION::ADDITION, negative_terms, 0, negative_terms.size());
+                if (!negative_sum) {
+                    return positive_sum;
+                }
+                return make(OPERATION::SUBTRACTION, positive_sum ? positive_sum : constant(0), negative_sum);
+            }
+
+            static bool flatten_product(const node& x, std::vector<node>& factors, size_t depth, size_t& max_depth) {
+                max_depth = std::max(max_depth, depth);
+                const real_operation<T>* product = as_operation(x, OPERATION::MULTIPLICATION);
+                if (product == nullptr) {
+                    factors.push_back(x);
+                    return factors.size() <= MAXIMUM_TERMS;
+                }
+                return flatten_product(product->lhs(), factors, depth + 1, max_depth) &&
+                       flatten_product(product->rhs(), factors, depth + 1, max_depth);
+            }
+
+            /**
+             * @brief Normalizes a chain of multiplications: the constant factors are merged into a
+             * single leading constant, which is dropped if it is one, and long chains are rebuilt
+             * balanced.
+             */
+            node product_normalization(OPERATION op, const node& lhs, const node& rhs) {
+                if (op != OPERATION::MULTIPLICATION) {
+                    return nullptr;
+                }
+                std::vector<node> factors;
+                size_t depth = 0;
+                if (!flatten_product(lhs, factors, 1, depth) || !flatten_product(rhs, factors, 1, depth)) {
+                    return nullptr;
+                }
+                bool changed = factors.size() >= 4 && depth > balanced_depth(factors.size()) + 1;
+
+                exact_number<T> constant_product = literals::one_exact<T>;
+                size_t constants = 0;
+                std::vector<node> result;
+                for (const node& factor : factors) {
+                    std::optional<exact_number<T>> value = constant_value(factor);
+                    if (value) {
+                        constant_product = constant_product * *value;
+                        ++constants;
+                    } else {
+                        result.push_back(factor);
+                    }
+                }
+                if (constants > 1) {
+                    changed = true;
+                }
+                if (!changed) {
+                    return nullptr;
+                }
+
+                if (constants > 0 && constant_product != literals::one_exact<T>) {
+                    result.insert(result.begin(), constant(constant_product));
+                }
+                if (result.empty()) {
+                    return constant(constant_product);
+                }
+                return balanced(OPERATION::MULTIPLICATION, result, 0, result.size());
+            }
+        };
+    }
+}
+
+#endif // BOOST_REAL_SIMPLIFICATION_HPP
@@ -0,0 +1,366 @@
+#ifndef BOOST_REAL_SNAPSHOT_HPP
+#define BOOST_REAL_SNAPSHOT_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+#include <real/real.hpp>
+
+namespace boost {
+    namespace real {
+
+        /**
+         * @brief A binary image of the DAG of boost::real::real numbers and of the progress of its
+         * evaluation, to checkpoint a long computation or to warm start another process.
+         *
+         * write() saves every node reachable from the numbers once, operands first, with its
+         * current approximation interval, precision and maximum precision. read() builds the same
+         * DAG again and resumes the iterator of every node, so the restored numbers are refined from
+         * the precision they had reached instead of from their first digit. The nodes shared by
+         * several numbers of a snapshot are shared by the restored numbers too.
+         *
+         * The nodes defined by code, algorithmic numbers, refinable enclosures such as the roots
+         * of boost::real::find_root and the FUNCTION operations, are saved as enclosures of their
+         * current interval, like boost::real::real::materialize: they can not be refined beyond it
+         * after a restore. Inputs are saved as the nodes of their current value. The restored nodes
+         * are not added to the node_table.
+         *
+         * Integers are written in little endian order, the digits with sizeof(T) bytes, so a
+         * snapshot is read back by a snapshot of the same digit type on any platform.
+         */
+        template <typename T = int>
+        class snapshot {
+            enum class NODE : std::uint8_t {EXPLICIT, RATIONAL, OPERATION, ENCLOSURE};
+
+            using node = std::shared_ptr<real_data<T>>;
+            using state = typename const_precision_iterator<T>::iterator_state;
+
+            static constexpr char MAGIC[8] = {'B', 'R', 'E', 'A', 'L', 'S', 'N', 'P'};
+            static constexpr std::uint32_t VERSION = 1;
+            static constexpr std::int64_t RADIX = (std::numeric_limits<T>::max() / 4) * 2;
+
+            static void write_integer(std::ostream& out, std::int64_t value, size_t bytes = 8) {
+                std::uint64_t bits = (std::uint64_t) value;
+                for (size_t i = 0; i < bytes; i++) {
+                    out.put((char) ((bits >> (8 * i)) & 0xff));
+                }
+            }
+
+            static std::int64_t read_integer(std::istream& in, size_t bytes = 8) {
+                std::uint64_t bits = 0;
+                for (size_t i = 0; i < bytes; i++) {
+                    int byte = in.get();
+                    if (byte == std::char_traits<char>::eof()) {
+                        throw invalid_snapshot_exception();
+                    }
+                    bits |= (std::uint64_t) (unsigned char) byte << (8 * i);
+                }
+                // sign extension of the values narrower than 64 bits
+                if (bytes < 8 && (bits >> (8 * bytes - 1)) & 1) {
+                    bits |= ~std::uint64_t(0) << (8 * bytes);
+                }
+                return (std::int64_t) bits;
+            }
+
+            /// a count or an index, which must be lower than limit
+            static size_t read_size(std::istream& in, size_t limit) {
+                std::int64_t value = read_integer(in);
+                if (value < 0 || (std::uint64_t) value >= limit) {
+                    throw invalid_snapshot_exception();
+                }
+                return (size_t) value;
+            }
+
+            static void write_digits(std::ostream& out, const std::vector<T>& digits) {
+                write_integer(out, (std::int64_t) digits.size());
+                for (T digit : digits) {
+                    write_integer(out, (std::int64_t) digit, sizeof(T));
+                }
+            }
+
+            static std::vector<T> read_digits(std::istream& in) {
+                size_t size = read_size(in, std::numeric_limits<std::int64_t>::max());
+                std::vector<T> digits;
+                for (size_t i = 0; i < size; i++) {
+                    std::int64_t digit = read_integer(in, sizeof(T));
+                    if (digit < 0 || digit >= RADIX) {
+                        throw invalid_snapshot_exception();
+                    }
+                    digits.push_back((T) digit);
+                }
+                return digits;
+            }
+
+            static void write_exact(std::ostream& out, const exact_number<T>& x) {
+                write_digits(out, x.digits);
+                write_integer(out, x.exponent);
+                out.put(x.positive ? 1 : 0);
+            }
+
+            static exact_number<T> read_exact(std::istream& in) {
+                exact_number<T> result;
+                result.digits = read_digits(in);
+                std::int64_t exponent = read_integer(in);
+                if (exponent < std::numeric_limits<int>::min() || exponent > std::numeric_limits<int>::max()) {
+                    throw invalid_snapshot_exception();
+                }
+                result.exponent = (int) exponent;
+                result.positive = read_flag(in);
+                return result;
+            }
+
+            static bool read_flag(std::istream& in) {
+                int flag = in.get();
+                if (flag != 0 && flag != 1) {
+                    throw invalid_snapshot_exception();
+                }
+                return flag == 1;
+            }
+
+            static void write_interval(std::ostream& out, const interval<T>& x) {
+                write_exact(out, x.lower_bound);
+                write_exact(out, x.upper_bound);
+            }
+
+            static interval<T> read_interval(std::istream& in) {
+                interval<T> result;
+                result.lower_bound = read_exact(in);
+                result.upper_bound = read_exact(in);
+                return result;
+            }
+
+            static void write_integer_number(std::ostream& out, const integer_number<T>& x) {
+                write_digits(out, x.digits);
+                out.put(x.positive ? 1 : 0);
+            }
+
+            static integer_number<T> read_integer_number(std::istream& in) {
+                integer_number<T> result;
+                result.digits = read_digits(in);
+                result.positive = read_flag(in);
+                return result;
+            }
+
+            /// true for the nodes defined by code, which are saved as enclosures
+            static bool materialized(real_data<T>* x) {
+                return std::visit(overloaded {
+                    [] (const real_algorithm<T>&) {
+                        return true;
+                    },
+                    [] (const real_operation<T>& ro) {
+                        return ro.get_operation() == OPERATION::FUNCTION;
+                    },
+                    [] (const real_enclosure<T>& enclosure) {
+                        return enclosure.refinable();
+                    },
+                    [] (const auto&) {
+                        return false;
+                    }
+                }, x->get_real_number());
+            }
+
+            /// the nodes reachable from x, operands first, each node once
+            static void sort_nodes(real_data<T>* x, std::vector<real_data<T>*>& nodes,
+                                   std::unordered_map<real_data<T>*, size_t>& indices) {
+                if (indices.count(x) != 0) {
+                    return;
+                }
+                const real_operation<T>* ro = std::get_if<real_operation<T>>(x->get_real_ptr());
+                if (ro != nullptr && !materialized(x)) {
+                    sort_nodes(ro->lhs().get(), nodes, indices);
+                    sort_nodes(ro->rhs().get(), nodes, indices);
+                    for (const auto& coefficient : ro->coefficients()) {
+                        sort_nodes(coefficient.get(), nodes, indices);
+                    }
+                }
+                indices[x] = nodes.size();
+                nodes.push_back(x);
+            }
+
+            static void write_node(std::ostream& out, real_data<T>* x, const std::unordered_map<real_data<T>*, size_t>& indices) {
+                state progress = x->get_precision_itr().state();
+                if (materialized(x)) {
+                    out.put((char) NODE::ENCLOSURE);
+                    write_interval(out, progress.approximation);
+                } else {
+                    std::visit(overloaded {
+                        [&out] (const real_explicit<T>& leaf) {
+                            out.put((char) NODE::EXPLICIT);
+                            write_exact(out, leaf.get_exact_number());
+                        },
+                        [&out] (const real_rational<T>& leaf) {
+                            out.put((char) NODE::RATIONAL);
+                            write_integer_number(out, leaf.a);
+                            write_integer_number(out, leaf.b);
+                            out.put(leaf.positive ? 1 : 0);
+                        },
+                        [&out, &indices] (const real_operation<T>& ro) {
+                            out.put((char) NODE::OPERATION);
+                            out.put((char) ro.get_operation());
+                            write_integer(out, (std::int64_t) indices.at(ro.lhs().get()));
+                            write_integer(out, (std::int64_t) indices.at(ro.rhs().get()));
+                            write_integer(out, (std::int64_t) ro.coefficients().size());
+                            for (const auto& coefficient : ro.coefficients()) {
+                                write_integer(out, (std::int64_t) indices.at(coefficient.get()));
+                            }
+                        },
+                        [&out] (const real_enclosure<T>& leaf) {
+                            out.put((char) NODE::ENCLOSURE);
+                            write_interval(out, leaf.get_interval());
+                        },
+                        [] (const auto&) {
+                            throw invalid_representation_exception();
+                        }
+                    }, x->get_real_number());
+                }
+
+                write_integer(out, (std::int64_t) progress.precision);
+                write_integer(out, (std::int64_t) progress.precision_bits);
+                write_integer(out, (std::int64_t) progress.maximum_precision);
+                write_interval(out, progress.approximation);
+            }
+
+            static node read_node(std::istream& in, const std::vector<node>& nodes) {
+                node result;
+                switch ((NODE) in.get()) {
+                    case NODE::EXPLICIT:
+                        result = std::make_shared<real_data<T>>(real_explicit<T>(read_exact(in)));
+                        break;
+
+                    case NODE::RATIONAL: {
+                        real_rational<T> leaf;
+                        leaf.a = read_integer_number(in);
+                        leaf.b = read_integer_number(in);
+                        leaf.positive = read_flag(in);
+                        result = std::make_shared<real_data<T>>(leaf);
+                        break;
+                    }
+
+                    case NODE::OPERATION: {
+                        int operation = in.get();
+                        if (operation < (int) OPERATION::ADDITION || operation >= (int) OPERATION::FUNCTION) {
+                            throw invalid_snapshot_exception();
+                        }
+                        node lhs = nodes[read_size(in, nodes.size())];
+                        node rhs = nodes[read_size(in, nodes.size())];
+                        size_t size = read_size(in, nodes.size() + 1);
+                        std::vector<node> coefficients;
+                        for (size_t i = 0; i < size; i++) {
+                            coefficients.push_back(nodes[read_size(in, nodes.size())]);
+                        }
+                        if ((OPERATION) operation == OPERATION::POLYNOMIAL) {
+                            result = std::make_shared<real_data<T>>(real_operation<T>(lhs, std::move(coefficients)));
+                        } else {
+                            result = std::make_shared<real_data<T>>(real_operation<T>(lhs, rhs, (OPERATION) operation));
+                        }
+                        break;
+                    }
+
+                    case NODE::ENCLOSURE:
+                        result = std::make_shared<real_data<T>>(real_enclosure<T>(read_interval(in)));
+                        break;
+
+                    default:
+                        throw invalid_snapshot_exception();
+                }
+
+                state progress;
+                progress.precision = read_size(in, std::numeric_limits<std::int64_t>::max());
+                progress.precision_bits = read_size(in, std::numeric_limits<std::int64_t>::max());
+                progress.maximum_precision = read_size(in, std::numeric_limits<std::int64_t>::max());
+                progress.approximation = read_interval(in);
+                if (progress.precision == 0) {
+                    throw invalid_snapshot_exception();
+                }
+                result->get_precision_itr().resume(progress);
+                return result;
+            }
+
+        public:
+
+            /**
+             * @brief Writes the DAG of the numbers and the progress of its evaluation to the binary
+             * stream out. The numbers are not modified.
+             *
+             * @throws boost::real::invalid_representation_exception if a number has no representation.
+             */
+            static void write(std::ostream& out, const std::vector<real<T>>& numbers) {
+                std::vector<real_data<T>*> nodes;
+                std::unordered_map<real_data<T>*, size_t> indices;
+                for (const real<T>& number : numbers) {
+                    sort_nodes(number._real_p.get(), nodes, indices);
+                }
+
+                out.write(MAGIC, sizeof(MAGIC));
+                write_integer(out, VERSION, 4);
+                write_integer(out, RADIX);
+                write_integer(out, (std::int64_t) nodes.size());
+                for (real_data<T>* x : nodes) {
+                    write_node(out, x, indices);
+                }
+                write_integer(out, (std::int64_t) numbers.size());
+                for (const real<T>& number : numbers) {
+                    write_integer(out, (std::int64_t) indices.at(number._real_p.get()));
+                }
+            }
+
+            /// writes the DAG of the number and the progress of its evaluation, see write
+            static void write(std::ostream& out, const real<T>& number) {
+                write(out, std::vector<real<T>> {number});
+            }
+
+            /**
+             * @brief Reads the numbers of a snapshot written by write from the binary stream in, at the
+             * precision their evaluation had reached.
+             *
+             * @throws boost::real::invalid_snapshot_exception if the stream does not hold a snapshot of
+             * numbers of the digit type T.
+             * @throws the exceptions of the first interval of the operations, which are not thrown
+             * for the snapshots of valid numbers.
+             */
+            static std::vector<real<T>> read_all(std::istream& in) {
+                char magic[sizeof(MAGIC)];
+                if (!in.read(magic, sizeof(MAGIC)) || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0 ||
+                    read_integer(in, 4) != VERSION || read_integer(in) != RADIX) {
+                    throw invalid_snapshot_exception();
+                }
+
+                size_t size = read_size(in, std::numeric_limits<std::int64_t>::max());
+                std::vector<node> nodes;
+                for (size_t i = 0; i < size; i++) {
+                    nodes.push_back(read_node(in, nodes));
+                }
+
+                size_t count = read_size(in, std::numeric_limits<std::int64_t>::max());
+                std::vector<real<T>> numbers;
+                for (size_t i = 0; i < count; i++) {
+                    numbers.push_back(real<T>(nodes[read_size(in, nodes.size())]));
+                }
+                return numbers;
+            }
+
+            /**
+             * @brief Reads the number of a snapshot of a single number, see read_all.
+             *
+             * @throws boost::real::invalid_snapshot_exception if the stream does not hold a snapshot of
+             * a single number of the digit type T.
+             */
+            static real<T> read(std::istream& in) {
+                std::vector<real<T>> numbers = read_all(in);
+                if (numbers.size() != 1) {
+                    throw invalid_snapshot_exception();
+                }
+                return numbers[0];
+            }
+        };
+    }
+}
+
+#endif // BOOST_REAL_SNAPSHOT_HPP
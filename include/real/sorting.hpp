@@ -0,0 +1,382 @@
+#ifndef BOOST_REAL_SORTING_HPP
+#define BOOST_REAL_SORTING_HPP
+
+#include <algorithm>
+#include <iterator>
+#include <optional>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <real/real.hpp>
+
+namespace boost {
+    namespace real {
+
+        namespace sorting_detail {
+            template <typename R>
+            struct digit_type;
+
+            template <typename T>
+            struct digit_type<real<T>> {
+                using type = T;
+            };
+
+            template <typename It>
+            using digit_type_t = typename digit_type<typename std::iterator_traits<It>::value_type>::type;
+
+            /// a number of the range with its enclosures, the exact one is only set when needed
+            template <typename T>
+            struct ranked {
+                real<T> number;
+                size_t position; // in the input range
+                double_interval fast;
+                interval<T> bounds;
+
+                using digit_type = T;
+
+                /// copies of a number share their node, so they are equal and share their refinement
+                static const real_data<T>* node(const real<T>& x) {
+                    return x._real_p.get();
+                }
+
+                const real_data<T>* node() const {
+                    return node(number);
+                }
+            };
+
+            template <typename T, typename It>
+            std::vector<ranked<T>> rank(It first, It last) {
+                std::vector<ranked<T>> entries;
+                entries.reserve(std::distance(first, last));
+                for (size_t position = 0; first != last; ++first, ++position) {
+                    entries.push_back({*first, position, first->double_enclosure(), interval<T>()});
+                }
+                return entries;
+            }
+
+            template <typename T>
+            void load_bounds(ranked<T>& x) {
+                x.bounds = x.number.get_real_itr().get_interval();
+            }
+
+            /// true if every entry of [first, last) is a copy of the same number
+            template <typename It>
+            bool same_node(It first, It last) {
+                return std::all_of(first, last, [&first] (const auto& x) { return x.node() == first->node(); });
+            }
+
+            /**
+             * @brief Refines every different number of [first, last) by one precision, once whatever
+             * the number of its copies, and reloads the bounds of all the entries.
+             *
+             * @return false if no number could be refined.
+             */
+            template <typename It>
+            bool refine(It first, It last) {
+                using T = typename std::iterator_traits<It>::value_type::digit_type;
+                std::unordered_set<const real_data<T>*> refined_nodes;
+                bool refined = false;
+                for (It it = first; it != last; ++it) {
+                    if (refined_nodes.insert(it->node()).second) {
+                        refined = it->number.refine() || refined;
+                    }
+                }
+                for (It it = first; it != last; ++it) {
+                    load_bounds(*it);
+                }
+                return refined;
+            }
+
+            /**
+             * @brief Calls f(begin, end) for every maximal run of [begin, end) whose enclosures
+             * overlap, transitively. The range must be sorted by lower bound, so every number of a
+             * run is strictly lower than every number of the following runs.
+             */
+            template <typename T, typename Lower, typename Upper, typename F>
+            void for_each_cluster(std::vector<ranked<T>>& entries, size_t begin, size_t end, Lower lower, Upper upper, F f) {
+                size_t cluster = begin;
+                auto max_upper = upper(entries[begin]);
+                for (size_t i = begin + 1; i < end; ++i) {
+                    if (max_upper < lower(entries[i])) {
+                        f(cluster, i);
+                        cluster = i;
+                        max_upper = upper(entries[i]);
+                    } else if (max_upper < upper(entries[i])) {
+                        max_upper = upper(entries[i]);
+                    }
+                }
+                f(cluster, end);
+            }
+
+            /**
+             * @brief Orders entries[begin, end). The numbers are first sorted by their double
+             * enclosures, then only the runs which still overlap are sorted by their exact intervals,
+             * refining every number of a run by one precision at a time. If target is set, only the
+             * run holding that position is ordered, which is what nth_element needs.
+             */
+            template <typename T>
+            void order(std::vector<ranked<T>>& entries, std::optional<size_t> target) {
+                if (entries.empty()) {
+                    return;
+                }
+                auto contains_target = [&target] (size_t begin, size_t end) {
+                    return !target || (begin <= *target && *target < end);
+                };
+
+                std::sort(entries.begin(), entries.end(), [] (const ranked<T>& a, const ranked<T>& b) {
+                    return a.fast.lower < b.fast.lower;
+                });
+
+                std::vector<std::pair<size_t, size_t>> pending;
+                for_each_cluster(entries, 0, entries.size(),
+                    [] (const ranked<T>& x) { return x.fast.lower; },
+                    [] (const ranked<T>& x) { return x.fast.upper; },
+                    [&] (size_t begin, size_t end) {
+                        if (end - begin > 1 && contains_target(begin, end)) {
+                            for (size_t i = begin; i < end; ++i) {
+                                load_bounds(entries[i]);
+                            }
+                            pending.push_back({begin, end});
+                        }
+                    });
+
+                while (!pending.empty()) {
+                    auto [begin, end] = pending.back();
+                    pending.pop_back();
+
+                    std::sort(entries.begin() + begin, entries.begin() + end, [] (const ranked<T>& a, const ranked<T>& b) {
+                        return a.bounds.lower_bound < b.bounds.lower_bound;
+                    });
+
+                    for_each_cluster(entries, begin, end,
+                        [] (const ranked<T>& x) -> const exact_number<T>& { return x.bounds.lower_bound; },
+                        [] (const ranked<T>& x) -> const exact_number<T>& { return x.bounds.upper_bound; },
+                        [&] (size_t cluster_begin, size_t cluster_end) {
+                            if (cluster_end - cluster_begin == 1 || !contains_target(cluster_begin, cluster_end)) {
+                                return;
+                            }
+                            // overlapping single numbers, or copies of one number, are equal,
+                            // so their run is already ordered
+                            auto run_begin = entries.begin() + cluster_begin;
+                            auto run_end = entries.begin() + cluster_end;
+                            bool all_numbers = std::all_of(run_begin, run_end, [] (const ranked<T>& x) {
+                                return x.bounds.is_a_number();
+                            });
+                            if (all_numbers || same_node(run_begin, run_end)) {
+                                return;
+                            }
+                            if (!refine(run_begin, run_end)) {
+                                throw boost::real::precision_exception();
+                            }
+                            pending.push_back({cluster_begin, cluster_end});
+                        });
+                }
+            }
+
+            template <typename T, typename It>
+            void write_back(const std::vector<ranked<T>>& entries, It first) {
+                for (const ranked<T>& x : entries) {
+                    *first = x.number;
+                    ++first;
+                }
+            }
+
+            /**
+             * @brief Finds the first lowest (or greatest) number. The candidates are the numbers
+             * whose enclosure reaches the best bound among the other enclosures, and only they are
+             * refined, one precision at a time, until a single one, equal single numbers or copies
+             * of one number remain.
+             */
+            template <typename It>
+            It extremum_element(It first, It last, bool greatest) {
+                using T = digit_type_t<It>;
+                if (first == last) {
+                    return last;
+                }
+                std::vector<ranked<T>> candidates = rank<T>(first, last);
+
+                // double filter, the best bound is the lowest upper bound for the minimum
+                double best = greatest ? candidates.front().fast.lower : candidates.front().fast.upper;
+                for (const ranked<T>& x : candidates) {
+                    best = greatest ? std::max(best, x.fast.lower) : std::min(best, x.fast.upper);
+                }
+                candidates.erase(std::remove_if(candidates.begin(), candidates.end(), [greatest, best] (const ranked<T>& x) {
+                    return greatest ? x.fast.upper < best : best < x.fast.lower;
+                }), candidates.end());
+                for (ranked<T>& x : candidates) {
+                    load_bounds(x);
+                }
+
+                while (candidates.size() > 1) {
+                    exact_number<T> bound = greatest ? candidates.front().bounds.lower_bound : candidates.front().bounds.upper_bound;
+                    for (const ranked<T>& x : candidates) {
+                        if (greatest ? bound < x.bounds.lower_bound : x.bounds.upper_bound < bound) {
+                            bound = greatest ? x.bounds.lower_bound : x.bounds.upper_bound;
+                        }
+                    }
+                    candidates.erase(std::remove_if(candidates.begin(), candidates.end(), [greatest, &bound] (const ranked<T>& x) {
+                        return greatest ? x.bounds.upper_bound < bound : bound < x.bounds.lower_bound;
+                    }), candidates.end());
+
+                    bool all_numbers = std::all_of(candidates.begin(), candidates.end(), [] (const ranked<T>& x) {
+                        return x.bounds.is_a_number();
+                    });
+                    if (all_numbers || same_node(candidates.begin(), candidates.end())) {
+                        break;
+                    }
+
+                    if (!refine(candidates.begin(), candidates.end())) {
+                        throw boost::real::precision_exception();
+                    }
+                }
+                // the candidates keep the range order, so this is the first of equal numbers
+                return std::next(first, candidates.front().position);
+            }
+        }
+
+        /**
+         * @brief Sorts the boost::real::real numbers of [first, last) in ascending order. Unlike
+         * std::sort with operator<, which refines both numbers from their first precision on every
+         * comparison, every number is refined at most once per precision: the numbers are ordered
+         * by their enclosures, and only the runs of numbers whose enclosures overlap are refined.
+         * Copies of a number are equal without refining, and share their refinement, which is kept
+         * by the numbers.
+         *
+         * @throws boost::real::precision_exception if different numbers of a run still overlap at
+         * their maximum precision.
+         */
+        template <typename RandomIt>
+        void sort(RandomIt first, RandomIt last) {
+            using T = sorting_detail::digit_type_t<RandomIt>;
+            std::vector<sorting_detail::ranked<T>> entries = sorting_detail::rank<T>(first, last);
+            sorting_detail::order(entries, std::nullopt);
+            sorting_detail::write_back(entries, first);
+        }
+
+        /**
+         * @brief Rearranges [first, last) so that *nth is the number which would be there if the
+         * range was sorted, no number before it is greater and no number after it is lower. Only
+         * the run of overlapping enclosures holding nth is refined.
+         *
+         * @throws boost::real::precision_exception as boost::real::sort.
+         */
+        template <typename RandomIt>
+        void nth_element(RandomIt first, RandomIt nth, RandomIt last) {
+            using T = sorting_detail::digit_type_t<RandomIt>;
+            if (nth == last) {
+                return;
+            }
+            std::vector<sorting_detail::ranked<T>> entries = sorting_detail::rank<T>(first, last);
+            sorting_detail::order(entries, (size_t) std::distance(first, nth));
+            sorting_detail::write_back(entries, first);
+        }
+
+        /**
+         * @brief Returns an iterator to the first lowest number of [first, last), or last if the
+         * range is empty. Only the numbers whose enclosures may hold the minimum are refined.
+         *
+         * @throws boost::real::precision_exception if different candidates still overlap at their
+         * maximum precision.
+         */
+        template <typename ForwardIt>
+        ForwardIt min_element(ForwardIt first, ForwardIt last) {
+            return sorting_detail::extremum_element(first, last, false);
+        }
+
+        /**
+         * @brief Returns an iterator to the first greatest number of [first, last), or last if the
+         * range is empty. Only the numbers whose enclosures may hold the maximum are refined.
+         *
+         * @throws boost::real::precision_exception as boost::real::min_element.
+         */
+        template <typename ForwardIt>
+        ForwardIt max_element(ForwardIt first, ForwardIt last) {
+            return sorting_detail::extremum_element(first, last, true);
+        }
+
+        /**
+         * @brief Moves the numbers of [first, last) lower than pivot before the other ones, keeping
+         * their relative order. The pivot is refined at most once per precision, and only the
+         * numbers whose enclosures overlap the pivot one are refined with it, once per precision
+         * whatever the number of their copies. Copies of the pivot are not lower than it.
+         *
+         * @return an iterator to the first number which is not lower than pivot.
+         *
+         * @throws boost::real::precision_exception if a number different from pivot still overlaps
+         * it at the maximum precision.
+         */
+        template <typename ForwardIt, typename T>
+        ForwardIt partition(ForwardIt first, ForwardIt last, const real<T>& pivot) {
+            using namespace sorting_detail;
+            std::vector<ranked<T>> entries = rank<T>(first, last);
+            enum class SIDE{LOWER, NOT_LOWER, UNKNOWN};
+            std::vector<SIDE> sides(entries.size(), SIDE::UNKNOWN);
+
+            double_interval pivot_fast = pivot.double_enclosure();
+            std::vector<size_t> undecided;
+            for (size_t i = 0; i < entries.size(); ++i) {
+                if (entries[i].node() == ranked<T>::node(pivot)) { // a copy of the pivot
+                    sides[i] = SIDE::NOT_LOWER;
+                } else if (entries[i].fast < pivot_fast) {
+                    sides[i] = SIDE::LOWER;
+                } else if (pivot_fast.upper <= entries[i].fast.lower) {
+                    sides[i] = SIDE::NOT_LOWER;
+                } else {
+                    load_bounds(entries[i]);
+                    undecided.push_back(i);
+                }
+            }
+
+            while (!undecided.empty()) {
+                interval<T> pivot_bounds = pivot.get_real_itr().get_interval();
+                std::vector<size_t> still_undecided;
+                for (size_t i : undecided) {
+                    if (entries[i].bounds < pivot_bounds) {
+                        sides[i] = SIDE::LOWER;
+                    } else if (pivot_bounds.upper_bound <= entries[i].bounds.lower_bound) {
+                        sides[i] = SIDE::NOT_LOWER;
+                    } else {
+                        still_undecided.push_back(i);
+                    }
+                }
+                undecided = std::move(still_undecided);
+                if (undecided.empty()) {
+                    break;
+                }
+
+                bool refined = pivot.refine();
+                std::unordered_set<const real_data<T>*> refined_nodes;
+                for (size_t i : undecided) {
+                    if (refined_nodes.insert(entries[i].node()).second) {
+                        refined = entries[i].number.refine() || refined;
+                    }
+                }
+                for (size_t i : undecided) {
+                    load_bounds(entries[i]);
+                }
+                if (!refined) {
+                    throw boost::real::precision_exception();
+                }
+            }
+
+            ForwardIt result = first;
+            for (size_t i = 0; i < entries.size(); ++i) {
+                if (sides[i] == SIDE::LOWER) {
+                    *result = entries[i].number;
+                    ++result;
+                }
+            }
+            ForwardIt it = result;
+            for (size_t i = 0; i < entries.size(); ++i) {
+                if (sides[i] != SIDE::LOWER) {
+                    *it = entries[i].number;
+                    ++it;
+                }
+            }
+            return result;
+        }
+    }
+}
+
+#endif // BOOST_REAL_SORTING_HPP
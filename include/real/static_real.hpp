@@ -0,0 +1,437 @@
+#ifndef BOOST_REAL_STATIC_REAL_HPP
+#define BOOST_REAL_STATIC_REAL_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <real/real.hpp>
+
+namespace boost {
+    namespace real {
+
+        /// the rounding direction of the boost::real::static_real results
+        enum class ROUNDING {TOWARD_ZERO, DOWNWARD, UPWARD};
+
+        namespace static_real_detail {
+#ifdef __SIZEOF_INT128__
+            __extension__ typedef __int128 int128;
+            __extension__ typedef unsigned __int128 uint128;
+#endif
+
+            /// returns the digits (a * b / radix, a * b % radix) of the product of two digits
+            template <typename T>
+            constexpr std::pair<T, T> digit_product(T a, T b, T radix) {
+                if constexpr (sizeof(T) <= 4) {
+                    using wide = std::conditional_t<std::is_signed_v<T>, long long, unsigned long long>;
+                    wide product = (wide) a * b;
+                    return {(T) (product / radix), (T) (product % radix)};
+#ifdef __SIZEOF_INT128__
+                } else if constexpr (sizeof(T) <= 8) {
+                    using wide = std::conditional_t<std::is_signed_v<T>, int128, uint128>;
+                    wide product = (wide) a * b;
+                    return {(T) (product / radix), (T) (product % radix)};
+#endif
+                } else {
+                    // as exact_number::mult_div and exact_number::mulmod, invariant: a * b = high * radix + low + a' * b'
+                    T high = 0;
+                    T low = 0;
+                    while (b != 0) {
+                        if (b & 1) {
+                            low += a;
+                            if (low >= radix) {
+                                low -= radix;
+                                high++;
+                            }
+                        }
+                        b /= 2;
+                        a *= 2;
+                        if (a >= radix) {
+                            a -= radix;
+                            high += b;
+                        }
+                    }
+                    return {high, low};
+                }
+            }
+        }
+
+        /**
+         * @brief A number of N digits of type T, in the base of boost::real::exact_number, with a
+         * fixed rounding direction. It is a value type whose digits are held by a std::array, so
+         * it does not allocate, and its addition, subtraction and multiplication are constexpr.
+         *
+         * The number is ±0.d_0 d_1 ... d_{N-1} * base^exponent, with d_0 not zero unless the number is
+         * zero. The results of the operations are rounded to N digits in the rounding direction
+         * of the left operand, so a DOWNWARD and an UPWARD evaluation of the same expression give
+         * a rigorous enclosure of it. Divisions are computed by the exact_number kernel, which
+         * allocates.
+         *
+         * @tparam N - the amount of digits.
+         * @tparam T - the digits type, as in boost::real::real.
+         */
+        template <size_t N, typename T = int>
+        class static_real {
+            static_assert(N > 0, "A static_real holds at least one digit");
+            static_assert(std::is_integral_v<T>, "The digits of a static_real are integers");
+
+        public:
+            /// the digits base, each digit is lower than RADIX
+            static constexpr T RADIX = (std::numeric_limits<T>::max() / 4) * 2;
+
+        private:
+            std::array<T, N> _digits {};
+            int _exponent = 0;
+            bool _positive = true;
+            ROUNDING _rounding = ROUNDING::TOWARD_ZERO;
+
+            // the exact sums and products, with a digit for the carry and one for the sticky digits
+            static constexpr size_t BUFFER = 2 * N + 2;
+            using buffer = std::array<T, BUFFER>;
+
+            constexpr bool away_from_zero() const {
+                return (_rounding == ROUNDING::UPWARD && _positive) || (_rounding == ROUNDING::DOWNWARD && !_positive);
+            }
+
+            /// adds one unit to the last digit
+            constexpr void increment() {
+                for (size_t i = N; i-- > 0;) {
+                    if (_digits[i] + 1 < RADIX) {
+                        _digits[i]++;
+                        return;
+                    }
+                    _digits[i] = 0;
+                }
+                _digits[0] = 1;
+                _exponent++;
+            }
+
+            /**
+             * @brief Sets the number to the digits rounded to N digits. The first digit has the
+             * weight base^(exponent - 1), and inexact means that the digits are only a truncation.
+             */
+            constexpr void assign(const buffer& digits, int exponent, bool positive, bool inexact) {
+                size_t first = 0;
+                while (first < BUFFER && digits[first] == 0) {
+                    first++;
+                }
+                if (first == BUFFER) {
+                    _digits = {};
+                    _exponent = 0;
+                    _positive = true;
+                    return;
+                }
+
+                _positive = positive;
+                _exponent = exponent - (int) first;
+                for (size_t i = 0; i < N; i++) {
+                    _digits[i] = first + i < BUFFER ? digits[first + i] : 0;
+                }
+                for (size_t i = first + N; i < BUFFER; i++) {
+                    inexact = inexact || digits[i] != 0;
+                }
+                if (inexact && away_from_zero()) {
+                    increment();
+                }
+            }
+
+            /// compares the absolute values, returns -1, 0 or 1
+            static constexpr int compare_magnitudes(const static_real& a, const static_real& b) {
+                if (a.is_zero() || b.is_zero()) {
+                    return (a.is_zero() ? 0 : 1) - (b.is_zero() ? 0 : 1);
+                }
+                if (a._exponent != b._exponent) {
+                    return a._exponent < b._exponent ? -1 : 1;
+                }
+                for (size_t i = 0; i < N; i++) {
+                    if (a._digits[i] != b._digits[i]) {
+                        return a._digits[i] < b._digits[i] ? -1 : 1;
+                    }
+                }
+                return 0;
+            }
+
+            /// a + b if b_positive is the sign of b, a - b otherwise
+            static constexpr static_real sum(const static_real& a, const static_real& b, bool b_positive) {
+                static_real result;
+                result._rounding = a._rounding;
+                if (b.is_zero()) {
+                    result = a;
+                    return result;
+                }
+                if (a.is_zero()) {
+                    result = b;
+                    result._positive = b_positive;
+                    result._rounding = a._rounding;
+                    return result;
+                }
+
+                bool same_sign = a._positive == b_positive;
+                int order = compare_magnitudes(a, b);
+                if (!same_sign && order == 0) {
+                    return result;
+                }
+                const static_real& larger = order >= 0 ? a : b;
+                const static_real& smaller = order >= 0 ? b : a;
+                bool positive = order >= 0 ? a._positive : b_positive;
+
+                buffer digits {};
+                buffer other {};
+                for (size_t i = 0; i < N; i++) {
+                    digits[i + 1] = larger._digits[i];
+                }
+
+                // an operand shifted beyond the buffer is replaced by a unit of its last digit,
+                // which rounds as any number between zero and that unit
+                bool inexact = false;
+                size_t shift = (size_t) (larger._exponent - smaller._exponent);
+                if (shift <= N) {
+                    for (size_t i = 0; i < N; i++) {
+                        other[i + 1 + shift] = smaller._digits[i];
+                    }
+                } else {
+                    other[BUFFER - 1] = 1;
+                    inexact = true;
+                }
+
+                T carry = 0;
+                for (size_t i = BUFFER; i-- > 0;) {
+                    if (same_sign) {
+                        T digit = digits[i] + other[i] + carry;
+                        carry = digit >= RADIX ? 1 : 0;
+                        digits[i] = digit - carry * RADIX;
+                    } else {
+                        T subtrahend = other[i] + carry;
+                        carry = digits[i] < subtrahend ? 1 : 0;
+                        digits[i] = digits[i] + carry * RADIX - subtrahend;
+                    }
+                }
+
+                result.assign(digits, larger._exponent + 1, positive, inexact);
+                return result;
+            }
+
+        public:
+
+            /// constructs zero, rounded toward zero
+            constexpr static_real() = default;
+
+            /// constructs the integer, which must have at most N digits
+            constexpr explicit static_real(T integer, ROUNDING rounding = ROUNDING::TOWARD_ZERO) : _rounding(rounding) {
+                buffer digits {};
+                _positive = integer >= 0;
+                int length = 0;
+                for (T rest = integer; rest != 0; rest /= RADIX) {
+                    length++;
+                }
+                T rest = integer;
+                for (int i = length - 1; i >= 0; i--) {
+                    T digit = rest % RADIX;
+                    digits[i] = digit < 0 ? -digit : digit;
+                    rest /= RADIX;
+                }
+                assign(digits, length, _positive, false);
+            }
+
+            /**
+             * @brief Constructs the number x rounded to N digits in the rounding direction, which
+             * is also the rounding direction of the operations on the number.
+             */
+            explicit static_real(exact_number<T> x, ROUNDING rounding = ROUNDING::TOWARD_ZERO) : _rounding(rounding) {
+                x.normalize();
+                if (x.digits.empty() || x.digits[0] == 0) {
+                    return;
+                }
+                _positive = x.positive;
+                _exponent = x.exponent;
+                bool inexact = false;
+                for (size_t i = 0; i < x.digits.size(); i++) {
+                    if (i < N) {
+                        _digits[i] = x.digits[i];
+                    } else {
+                        inexact = inexact || x.digits[i] != 0;
+                    }
+                }
+                if (inexact && away_from_zero()) {
+                    increment();
+                }
+            }
+
+            /**
+             * @brief Constructs an approximation of x: the upper bound of its interval at N + 2 digits
+             * of precision, or its maximum precision, rounded up if rounding is UPWARD, its lower bound rounded down if it is
+             * DOWNWARD, and otherwise the bound nearest to zero rounded toward zero.
+             */
+            explicit static_real(const real<T>& x, ROUNDING rounding = ROUNDING::TOWARD_ZERO) {
+                const_precision_iterator<T> it = x.get_real_itr();
+                size_t precision = std::min<size_t>(N + 2, it.maximum_precision());
+                if (it.get_precision() < precision) {
+                    it.iterate_n_times(precision - it.get_precision());
+                }
+                const interval<T>& enclosure = it.get_interval();
+
+                switch (rounding) {
+                    case ROUNDING::UPWARD:
+                        *this = static_real(enclosure.upper_bound, rounding);
+                        break;
+                    case ROUNDING::DOWNWARD:
+                        *this = static_real(enclosure.lower_bound, rounding);
+                        break;
+                    case ROUNDING::TOWARD_ZERO:
+                        if (enclosure.positive()) {
+                            *this = static_real(enclosure.lower_bound, rounding);
+                        } else if (enclosure.negative()) {
+                            *this = static_real(enclosure.upper_bound, rounding);
+                        } else {
+                            *this = static_real();
+                        }
+                        break;
+                }
+            }
+
+            /// the number as an exact_number
+            exact_number<T> to_exact() const {
+                if (is_zero()) {
+                    return exact_number<T>(std::vector<T> {0}, 0);
+                }
+                exact_number<T> result(std::vector<T>(_digits.begin(), _digits.end()), _exponent, _positive);
+                result.normalize();
+                return result;
+            }
+
+            /// the number as an explicit boost::real::real
+            real<T> to_real() const {
+                return real<T>(real_explicit<T>(to_exact()));
+            }
+
+            constexpr const std::array<T, N>& digits() const {
+                return _digits;
+            }
+
+            constexpr int exponent() const {
+                return _exponent;
+            }
+
+            constexpr bool positive() const {
+                return _positive;
+            }
+
+            constexpr ROUNDING rounding() const {
+                return _rounding;
+            }
+
+            constexpr bool is_zero() const {
+                return _digits[0] == 0;
+            }
+
+            constexpr static_real operator-() const {
+                static_real result = *this;
+                result._positive = is_zero() || !_positive;
+                return result;
+            }
+
+            friend constexpr static_real operator+(const static_real& a, const static_real& b) {
+                return sum(a, b, b._positive);
+            }
+
+            friend constexpr static_real operator-(const static_real& a, const static_real& b) {
+                return sum(a, b, !b._positive);
+            }
+
+            friend constexpr static_real operator*(const static_real& a, const static_real& b) {
+                static_real result;
+                result._rounding = a._rounding;
+                if (a.is_zero() || b.is_zero()) {
+                    return result;
+                }
+
+                // schoolbook multiplication, the 2N digits of the product are exact
+                buffer digits {};
+                for (size_t i = N; i-- > 0;) {
+                    T carry = 0;
+                    for (size_t j = N; j-- > 0;) {
+                        auto [high, low] = static_real_detail::digit_product(a._digits[i], b._digits[j], RADIX);
+                        T digit = digits[i + j + 1] + low;
+                        T overflow = 0;
+                        if (digit >= RADIX) {
+                            digit -= RADIX;
+                            overflow++;
+                        }
+                        digit += carry;
+                        if (digit >= RADIX) {
+                            digit -= RADIX;
+                            overflow++;
+                        }
+                        digits[i + j + 1] = digit;
+                        carry = high + overflow;
+                    }
+                    digits[i] = carry;
+                }
+
+                result.assign(digits, a._exponent + b._exponent, a._positive == b._positive, false);
+                return result;
+            }
+
+            /**
+             * @brief a / b, computed with exact_number::divide_vector_bits to N + 1 digits and rounded
+             * to N digits in the rounding direction of a.
+             *
+             * @throws boost::real::divide_by_zero if b is zero.
+             */
+            friend static_real operator/(const static_real& a, const static_real& b) {
+                if (b.is_zero()) {
+                    throw divide_by_zero();
+                }
+                if (a.is_zero()) {
+                    return static_real(exact_number<T>(), a._rounding);
+                }
+                static_real result;
+                result._rounding = a._rounding;
+                result._positive = a._positive == b._positive;
+
+                exact_number<T> quotient = a.to_exact();
+                quotient.divide_vector_bits(b.to_exact(), (N + 1) * exact_number<T>::BITS_PER_DIGIT, result.away_from_zero());
+                return static_real(quotient, a._rounding);
+            }
+
+            /// compares the values, returns -1, 0 or 1
+            friend constexpr int compare(const static_real& a, const static_real& b) {
+                if (a._positive != b._positive) {
+                    return a._positive ? 1 : -1;
+                }
+                int order = compare_magnitudes(a, b);
+                return a._positive ? order : -order;
+            }
+
+            friend constexpr bool operator==(const static_real& a, const static_real& b) {
+                return compare(a, b) == 0;
+            }
+
+            friend constexpr bool operator!=(const static_real& a, const static_real& b) {
+                return compare(a, b) != 0;
+            }
+
+            friend constexpr bool operator<(const static_real& a, const static_real& b) {
+                return compare(a, b) < 0;
+            }
+
+            friend constexpr bool operator>(const static_real& a, const static_real& b) {
+                return compare(a, b) > 0;
+            }
+
+            friend constexpr bool operator<=(const static_real& a, const static_real& b) {
+                return compare(a, b) <= 0;
+            }
+
+            friend constexpr bool operator>=(const static_real& a, const static_real& b) {
+                return compare(a, b) >= 0;
+            }
+        };
+    }
+}
+
+#endif // BOOST_REAL_STATIC_REAL_HPP
@@ -0,0 +1,77 @@
+#include <catch2/catch.hpp>
+#include <test_helpers.hpp>
+
+TEST_CASE("Centered forms of operations sharing nodes") {
+    using real = boost::real::real<int>;
+    using centered_form = boost::real::centered_form<int>;
+
+    auto width = [] (real x, size_t bits) {
+        auto it = x.get_real_itr();
+        it.refine_to_bits(bits);
+        return it.get_interval().width().leading_bit();
+    };
+    auto encloses = [] (real x, size_t bits, double value) {
+        auto it = x.get_real_itr();
+        it.refine_to_bits(bits);
+        return it.get_interval().lower_bound.as_double() <= value * (1 + 1e-15) &&
+               value * (1 - 1e-15) <= it.get_interval().upper_bound.as_double();
+    };
+
+    SECTION("Repeated variables") {
+        // the logistic map x = 3 x (1 - x), whose naive intervals add the width of both factors at every step
+        real x = real("1") / real("3");
+        real naive = x;
+        real centered = x;
+        for (int k = 0; k < 12; k++) {
+            naive = real("3") * naive * (real("1") - naive);
+            centered = real("3") * centered * (real("1") - centered);
+        }
+
+        int naive_width = width(naive, 120);
+        centered_form::enabled = true;
+        int centered_width = width(centered, 120);
+        centered_form::enabled = false;
+
+        CHECK(centered_width < naive_width - 8);
+    }
+
+    SECTION("Cancellations") {
+        // x - x^2 = 2 / 9 at x = 1 / 3
+        real x = real("1") / real("3");
+        centered_form::enabled = true;
+        real z = x - x * x;
+        CHECK(encloses(z, 90, 2.0 / 9));
+        CHECK(real("0.2222") < z);
+        CHECK(z < real("0.2223"));
+        centered_form::enabled = false;
+    }
+
+    SECTION("Divisions") {
+        // x / (1 + x) = 1 / 4 at x = 1 / 3
+        real x = real("1") / real("3");
+        real naive = x / (real("1") + x);
+        real centered = x / (real("1") + x);
+
+        int naive_width = width(naive, 60);
+        centered_form::enabled = true;
+        int centered_width = width(centered, 60);
+        CHECK(encloses(centered, 60, 0.25));
+        centered_form::enabled = false;
+
+        CHECK(centered_width <= naive_width);
+        CHECK(encloses(naive, 60, 0.25));
+    }
+
+    SECTION("Expressions without shared nodes are unchanged") {
+        real x = real("1") / real("3");
+        real y = real("1") / real("7");
+        real naive = x * (real("1") - y);
+        real centered = x * (real("1") - y);
+
+        int naive_width = width(naive, 60);
+        centered_form::enabled = true;
+        int centered_width = width(centered, 60);
+        centered_form::enabled = false;
+        CHECK(centered_width == naive_width);
+    }
+}
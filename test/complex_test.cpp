@@ -0,0 +1,87 @@
+#include <catch2/catch.hpp>
+#include <test_helpers.hpp>
+#include <real/complex.hpp>
+
+TEST_CASE("Complex numbers with fused operations") {
+    using real = boost::real::real<int>;
+    using complex = boost::real::complex<int>;
+
+    auto between = [] (real x, const std::string& lower, const std::string& upper) {
+        return real(lower) < x && x < real(upper);
+    };
+
+    SECTION("Additions and subtractions") {
+        complex z = complex("1", "2") + complex("3", "-5");
+        CHECK(z.real_part() == real("4"));
+        CHECK(z.imaginary_part() == real("-3"));
+
+        complex w = z - complex("4");
+        CHECK(w.real_part() == real("0"));
+        CHECK(w.imaginary_part() == real("-3"));
+        CHECK(w.conj().imaginary_part() == real("3"));
+        CHECK(w.norm() == real("9"));
+    }
+
+    SECTION("Multiplications") {
+        complex z = complex("1", "2") * complex("3", "4");
+        CHECK(z.real_part() == real("-5"));
+        CHECK(z.imaginary_part() == real("10"));
+
+        complex i("0", "1");
+        complex minus_one = i * i;
+        CHECK(minus_one.real_part() == real("-1"));
+        CHECK(minus_one.imaginary_part() == real("0"));
+
+        complex w = complex(real("1") / real("3"), real("1") / real("7")) * complex("2", "-1");
+        CHECK(between(w.real_part(), "0.80952380952", "0.80952380953"));
+        CHECK(between(w.imaginary_part(), "-0.04761904762", "-0.04761904761"));
+    }
+
+    SECTION("Products of products") {
+        // (0.6 + 0.8i)^16 by repeated squaring, on the unit circle
+        complex w("0.6", "0.8");
+        for (int k = 0; k < 4; k++) {
+            w = w * w;
+        }
+        CHECK(between(w.real_part(), "-0.64387845225", "-0.64387845224"));
+        CHECK(between(w.imaginary_part(), "0.76512779242", "0.76512779243"));
+        CHECK(between(w.norm(), "0.99999999999", "1.00000000001"));
+    }
+
+    SECTION("Divisions") {
+        complex z = complex("1", "2") / complex("3", "4");
+        CHECK(between(z.real_part(), "0.43999999999", "0.44000000001"));
+        CHECK(between(z.imaginary_part(), "0.07999999999", "0.08000000001"));
+
+        complex one = complex("3", "4") / complex("3", "4");
+        CHECK(between(one.real_part(), "0.99999999999", "1.00000000001"));
+
+        CHECK_THROWS_AS(complex("1", "2") / complex("0", "0"), boost::real::divergent_division_result_exception);
+    }
+
+    SECTION("Exponentials") {
+        complex z = boost::real::exp(complex("1", "0.5"));
+        CHECK(between(z.real_part(), "2.38551673095", "2.38551673096"));
+        CHECK(between(z.imaginary_part(), "1.30321372968", "1.30321372969"));
+
+        // the imaginary part 2 is past the maximum of sin and the zero of cos
+        complex w = complex::exp(complex("-0.5", "2"));
+        CHECK(between(w.real_part(), "-0.25240581531", "-0.25240581530"));
+        CHECK(between(w.imaginary_part(), "0.55151676816", "0.55151676817"));
+    }
+
+    SECTION("Rectangular and ball enclosures") {
+        complex z = complex(real("1") / real("3"), real("2")) * complex("1", "1");
+        boost::real::complex_interval<int> rectangle = z.enclosure(100);
+        CHECK(rectangle.tight(100));
+        CHECK(rectangle.real_part.lower_bound.as_double() <= -5.0 / 3 * (1 - 1e-15));
+        CHECK(-5.0 / 3 * (1 + 1e-15) <= rectangle.real_part.upper_bound.as_double());
+        CHECK(rectangle.imaginary_part.lower_bound.as_double() <= 7.0 / 3 * (1 + 1e-15));
+        CHECK(7.0 / 3 * (1 - 1e-15) <= rectangle.imaginary_part.upper_bound.as_double());
+
+        boost::real::complex_ball<int> ball = z.ball(100);
+        CHECK(ball.radius.leading_bit() < -95);
+        CHECK(ball.real_center.as_double() == Approx(-5.0 / 3));
+        CHECK(ball.imaginary_center.as_double() == Approx(7.0 / 3));
+    }
+}
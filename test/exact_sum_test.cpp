@@ -0,0 +1,86 @@
+#include <catch2/catch.hpp>
+#include <test_helpers.hpp>
+#include <real/exact_sum.hpp>
+
+TEMPLATE_TEST_CASE("Exact sums and dot products", "[template]", int, long) {
+    using real = boost::real::real<TestType>;
+    using exact_number = boost::real::exact_number<TestType>;
+    TestType base = (std::numeric_limits<TestType>::max() / 4) * 2 - 1;
+
+    // numbers of 1 to 4 digits, with exponents in [-6, 6] and both signs
+    std::vector<exact_number> numbers;
+    unsigned long long seed = 12345;
+    for (int k = 0; k < 200; k++) {
+        std::vector<TestType> digits;
+        for (int i = 0; i <= k % 4; i++) {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            digits.push_back((TestType) ((seed >> 33) % (unsigned long long) base) + (i == 0 ? 1 : 0));
+        }
+        exact_number x(digits, k % 13 - 6, k % 3 != 0);
+        x.normalize();
+        numbers.push_back(x);
+    }
+
+    auto sum = [] (const std::vector<exact_number>& values) {
+        exact_number result;
+        for (const exact_number& x : values) {
+            result = result + x;
+        }
+        result.normalize();
+        return result;
+    };
+
+    SECTION("The sum is the sum of the exact_number additions") {
+        CHECK(boost::real::exact_sum(numbers) == sum(numbers));
+    }
+
+    SECTION("Cancellations are exact") {
+        boost::real::exact_accumulator<TestType> accumulator;
+        accumulator.add(exact_number(std::vector<TestType> {7}, 40));
+        for (const exact_number& x : numbers) {
+            accumulator.add(x);
+        }
+        for (const exact_number& x : numbers) {
+            accumulator.subtract(x);
+        }
+        CHECK(accumulator.value() == exact_number(std::vector<TestType> {7}, 40));
+
+        accumulator.subtract(exact_number(std::vector<TestType> {7}, 40));
+        CHECK(accumulator.value() == exact_number(std::vector<TestType> {0}, 0));
+
+        accumulator.add(exact_number(std::vector<TestType> {1}, -30, false));
+        CHECK(accumulator.value() == exact_number(std::vector<TestType> {1}, -30, false));
+    }
+
+    SECTION("Carries over many maximum digits") {
+        std::vector<exact_number> maximums(1000, exact_number(std::vector<TestType> {base, base, base}, 1));
+        CHECK(boost::real::exact_sum(maximums) == sum(maximums));
+
+        std::vector<exact_number> negatives(1000, exact_number(std::vector<TestType> {base, base, base}, 1, false));
+        negatives.push_back(exact_number(std::vector<TestType> {1}, 4));
+        CHECK(boost::real::exact_sum(negatives) == sum(negatives));
+    }
+
+    SECTION("The dot product is the sum of the exact_number products") {
+        std::vector<exact_number> x(numbers.begin(), numbers.begin() + 100);
+        std::vector<exact_number> y(numbers.begin() + 100, numbers.end());
+        std::vector<exact_number> products;
+        for (size_t i = 0; i < x.size(); i++) {
+            products.push_back(x[i] * y[i]);
+        }
+
+        CHECK(boost::real::exact_dot(x, y) == sum(products));
+        CHECK_THROWS_AS(boost::real::exact_dot(x, numbers), boost::real::exact_dot_size_mismatch_exception);
+    }
+
+    SECTION("Explicit real numbers") {
+        std::vector<real> terms = {real("123456789012345678901234567890"), real("-98765432109876543210"), real("1")};
+        CHECK(boost::real::exact_sum(terms) == real("123456788913580246791358024681"));
+
+        std::vector<real> factors = {real("2"), real("3"), real("-5")};
+        CHECK(boost::real::exact_dot(terms, factors) == real("246913577728395061472839506145"));
+
+        std::vector<real> operations = {real("1"), real("1") / real("3")};
+        CHECK_THROWS_AS(boost::real::exact_sum(operations), boost::real::invalid_representation_exception);
+    }
+}
@@ -0,0 +1,81 @@
+#include <catch2/catch.hpp>
+#include <test_helpers.hpp>
+#include <real/find_root.hpp>
+
+TEST_CASE("Roots found by the interval Newton method") {
+    using real = boost::real::real<int>;
+
+    auto square = [] (real x) { return x * x - real("2"); };
+    auto square_prime = [] (real x) { return real("2") * x; };
+
+    SECTION("Square root of two") {
+        real root = boost::real::find_root(square, square_prime, real("1"), real("2"));
+
+        CHECK(real("1.41421356237") < root);
+        CHECK(root < real("1.41421356238"));
+
+        // further refinements continue the iteration
+        auto it = root.get_real_itr();
+        it.iterate_n_times(7);
+        CHECK(it.get_interval().tight(7 * 30));
+        CHECK(it.get_interval().lower_bound.as_double() == Approx(1.4142135623730951));
+
+        real squared = root * root;
+        CHECK(real("1.99999999999") < squared);
+        CHECK(squared < real("2.00000000001"));
+    }
+
+    SECTION("Exact roots") {
+        real root = boost::real::find_root([] (real x) { return x - real("3"); },
+                                           [] (real) { return real("1"); }, real("1"), real("5"));
+        CHECK(root == real("3"));
+    }
+
+    SECTION("Derivatives containing zero bisect the bracket") {
+        // x^3 - 2x - 5, whose derivative vanishes in the bracket
+        auto f = [] (real x) { return x * x * x - real("2") * x - real("5"); };
+        auto f_prime = [] (real x) { return real("3") * x * x - real("2"); };
+        real root = boost::real::find_root(f, f_prime, real("-3"), real("3"));
+
+        CHECK(real("2.0945514815") < root);
+        CHECK(root < real("2.0945514816"));
+    }
+
+    SECTION("The signs at the bracket bounds are decided at the precision of the steps") {
+        // a bracket within 2^-110 of the square root of two, where the sign of f at both bounds
+        // is not known at the precision of the first evaluations
+        real lower("1.414213562373095048801688724209698");
+        real upper("1.414213562373095048801688724209699");
+
+        // a valid but loose derivative, which contains zero so every step bisects
+        boost::real::interval<int> slack;
+        slack.lower_bound = boost::real::exact_number<int>("-3");
+        slack.upper_bound = boost::real::exact_number<int>("0");
+        auto loose_prime = [slack] (real x) { return real("2") * x + real(boost::real::real_enclosure<int>(slack)); };
+
+        real root = boost::real::find_root(square, loose_prime, lower, upper);
+        auto it = root.get_real_itr();
+        CHECK_NOTHROW(it.iterate_n_times(5));
+        CHECK(it.get_interval().tight(5 * 30));
+        CHECK(it.get_interval().lower_bound.as_double() == Approx(1.4142135623730951));
+    }
+
+    SECTION("Brackets without roots") {
+        real root = boost::real::find_root([] (real x) { return x * x + real("1"); },
+                                           [] (real x) { return real("2") * x; }, real("1"), real("2"));
+        auto it = root.get_real_itr();
+        CHECK_THROWS_AS(it.iterate_n_times(2), boost::real::root_not_bracketed_exception);
+    }
+
+    SECTION("Roots are operands of other numbers") {
+        real root = boost::real::find_root(square, square_prime, real("0"), real("5"));
+        real x = root * root * root - real("2") * root;
+
+        // (sqrt 2)^3 - 2 sqrt 2 = 0
+        auto it = x.get_real_itr();
+        it.iterate_n_times(5);
+        CHECK(it.get_interval().lower_bound <= boost::real::literals::zero_exact<int>);
+        CHECK(boost::real::literals::zero_exact<int> <= it.get_interval().upper_bound);
+        CHECK(it.get_interval().width().leading_bit() < -100);
+    }
+}
@@ -0,0 +1,147 @@
+#include <catch2/catch.hpp>
+#include <test_helpers.hpp>
+
+TEMPLATE_TEST_CASE("Fixed precision arithmetic on boost::real::interval", "[template]", int, long) {
+    using exact_number = boost::real::exact_number<TestType>;
+    using interval = boost::real::interval<TestType>;
+    size_t bits = 96;
+
+    // the interval [n, n] of an integer n
+    auto point = [] (const std::string& integer) {
+        auto it = boost::real::real<TestType>(integer).get_real_itr();
+        return it.cend().get_interval();
+    };
+
+    auto value = [&point] (const std::string& integer) {
+        return point(integer).lower_bound;
+    };
+
+    auto contains = [] (const interval& x, const exact_number& number) {
+        return x.lower_bound <= number && number <= x.upper_bound;
+    };
+
+    // bits counts whole digits, of which the leading one may only hold a single bit
+    auto tight = [bits] (const interval& x) {
+        int significant_bits = (int) bits - (int) exact_number::BITS_PER_DIGIT;
+        return x.width().as_double() <= std::abs(x.upper_bound.as_double()) * std::ldexp(1.0, -significant_bits);
+    };
+
+    SECTION("Basic operations enclose their exact results") {
+        interval x = point("12");
+        interval y = point("-5");
+
+        interval sum = boost::real::add(x, y, bits);
+        interval difference = boost::real::sub(x, y, bits);
+        interval product = boost::real::mul(x, y, bits);
+        CHECK(sum == point("7"));
+        CHECK(difference == point("17"));
+        CHECK(product == point("-60"));
+
+        interval quotient = boost::real::div(point("1"), point("3"), bits);
+        CHECK(quotient.lower_bound < quotient.upper_bound);
+        CHECK(tight(quotient));
+        interval back = boost::real::mul(quotient, point("3"), bits);
+        CHECK(contains(back, value("1")));
+
+        interval negative_quotient = boost::real::div(point("1"), point("-7"), bits);
+        CHECK(contains(boost::real::mul(negative_quotient, point("-7"), bits), value("1")));
+        CHECK(negative_quotient.upper_bound < value("0"));
+    }
+
+    SECTION("Products of intervals around zero") {
+        interval x;
+        x.lower_bound = value("-2");
+        x.upper_bound = value("3");
+        interval y;
+        y.lower_bound = value("-5");
+        y.upper_bound = value("4");
+
+        interval product = boost::real::mul(x, y, bits);
+        CHECK(product.lower_bound == value("-15"));
+        CHECK(product.upper_bound == value("12"));
+        CHECK_THROWS_AS(boost::real::div(y, x, bits), boost::real::divergent_division_result_exception);
+    }
+
+    SECTION("Square roots") {
+        interval root = boost::real::sqrt(point("2"), bits);
+        CHECK(root.lower_bound * root.lower_bound <= value("2"));
+        CHECK(value("2") <= root.upper_bound * root.upper_bound);
+        CHECK(tight(root));
+
+        interval exact_root = boost::real::sqrt(point("1522756"), bits);
+        CHECK(contains(exact_root, value("1234")));
+        CHECK(tight(exact_root));
+
+        interval large = boost::real::sqrt(point("123456789012345678901234567890"), bits);
+        CHECK(large.lower_bound * large.lower_bound <= value("123456789012345678901234567890"));
+        CHECK(value("123456789012345678901234567890") <= large.upper_bound * large.upper_bound);
+        CHECK(tight(large));
+
+        // sqrt(1 / 10^10) = 1 / 10^5
+        interval small = boost::real::sqrt(boost::real::div(point("1"), point("10000000000"), bits), bits);
+        interval expected = boost::real::div(point("1"), point("100000"), bits);
+        CHECK(small.lower_bound <= expected.upper_bound);
+        CHECK(expected.lower_bound <= small.upper_bound);
+
+        interval around_zero;
+        around_zero.lower_bound = value("-1");
+        around_zero.upper_bound = value("4");
+        interval clamped = boost::real::sqrt(around_zero, bits);
+        CHECK(clamped.lower_bound == value("0"));
+        CHECK(contains(clamped, value("2")));
+
+        CHECK_THROWS_AS(boost::real::sqrt(point("-1"), bits), boost::real::square_root_not_defined_for_negative_number);
+    }
+
+    SECTION("Exponentials and logarithms") {
+        interval one = boost::real::exp(point("0"), bits);
+        CHECK(contains(one, value("1")));
+
+        interval e = boost::real::exp(point("1"), bits);
+        CHECK(tight(e));
+        CHECK(e.lower_bound.as_double() <= 2.7182818284590456);
+        CHECK(2.7182818284590450 <= e.upper_bound.as_double());
+
+        interval x = point("7");
+        interval round_trip = boost::real::exp(boost::real::log(x, bits), bits);
+        CHECK(contains(round_trip, value("7")));
+
+        CHECK_THROWS_AS(boost::real::log(point("0"), bits), boost::real::logarithm_not_defined_for_non_positive_number);
+    }
+
+    SECTION("Sines and cosines") {
+        auto [sin_zero, cos_zero] = boost::real::sin_cos(point("0"), bits);
+        CHECK(contains(sin_zero, value("0")));
+        CHECK(contains(cos_zero, value("1")));
+
+        // [1, 2] holds the maximum of sin at pi / 2 and the zero of cos
+        interval x;
+        x.lower_bound = value("1");
+        x.upper_bound = value("2");
+        auto [sin, cos] = boost::real::sin_cos(x, bits);
+        CHECK(sin.upper_bound == value("1"));
+        CHECK(sin.lower_bound.as_double() <= 0.8414709848078965);
+        CHECK(0.8414709848078964 <= sin.lower_bound.as_double());
+        CHECK(cos.lower_bound.as_double() <= -0.4161468365471424);
+        CHECK(0.5403023058681397 <= cos.upper_bound.as_double());
+        CHECK(cos.upper_bound.as_double() <= 0.5403023058681399);
+
+        interval wide;
+        wide.lower_bound = value("0");
+        wide.upper_bound = value("4");
+        auto [sin_wide, cos_wide] = boost::real::sin_cos(wide, bits);
+        CHECK(sin_wide.lower_bound == value("-1"));
+        CHECK(cos_wide.upper_bound == value("1"));
+    }
+
+    SECTION("Results agree with the lazy numbers") {
+        boost::real::real<TestType> lazy = boost::real::real<TestType>("1") / boost::real::real<TestType>("3") +
+                                          boost::real::real<TestType>("2");
+        interval fixed = boost::real::add(boost::real::div(point("1"), point("3"), bits), point("2"), bits);
+
+        auto it = lazy.get_real_itr();
+        it.iterate_n_times(6);
+        CHECK(fixed.lower_bound <= it.get_interval().upper_bound);
+        CHECK(it.get_interval().lower_bound <= fixed.upper_bound);
+    }
+}
@@ -0,0 +1,56 @@
+#include <catch2/catch.hpp>
+#include <test_helpers.hpp>
+
+TEST_CASE("Approximate a boost::real::real up to a tolerance") {
+    using real = boost::real::real<int>;
+    using exact_number = boost::real::exact_number<int>;
+    using TOLERANCE = boost::real::TOLERANCE;
+
+    SECTION("Explicit numbers stop at their full precision") {
+        real a({1, 2, 3}, 1);
+        auto result = a.approximate(real({1}, -5));
+
+        CHECK(result.enclosure.is_a_number());
+        CHECK(result.precision == 3);
+    }
+
+    SECTION("Operations stop as soon as the absolute tolerance is met") {
+        real a(one_and_max, 1);
+        real b(ones, 1);
+        real c = a + b;
+        exact_number eps(std::vector<int> {1}, -3);
+
+        auto result = c.approximate(real({1}, -3));
+
+        CHECK(result.enclosure.width() <= eps);
+        CHECK(result.precision == 6);
+        CHECK(result.precision_bits <= 6 * boost::real::exact_number<int>::BITS_PER_DIGIT);
+        CHECK(result.enclosure.lower_bound <= c.get_real_itr().get_interval().lower_bound);
+        CHECK(c.get_real_itr().get_interval().upper_bound <= result.enclosure.upper_bound);
+    }
+
+    SECTION("Relative tolerance scales with the number magnitude") {
+        real a(ones, -3);
+        exact_number eps(std::vector<int> {1}, -1);
+
+        auto result = a.approximate(real({1}, -1), TOLERANCE::RELATIVE);
+        exact_number target = result.enclosure.lower_bound * eps;
+
+        CHECK(result.enclosure.width() <= target);
+        CHECK(result.precision < 5);
+    }
+
+    SECTION("An unreachable tolerance throws a precision_exception") {
+        real a(ones, 1);
+        a.set_maximum_precision(3);
+
+        CHECK_THROWS_AS(a.approximate(real({1}, -10)), boost::real::precision_exception);
+    }
+
+    SECTION("Non positive tolerances are rejected") {
+        real a(ones, 1);
+
+        CHECK_THROWS_AS(a.approximate(real("0")), boost::real::invalid_tolerance_exception);
+        CHECK_THROWS_AS(a.approximate(real("-1")), boost::real::invalid_tolerance_exception);
+    }
+}
@@ -0,0 +1,72 @@
+#include <catch2/catch.hpp>
+#include <test_helpers.hpp>
+
+TEST_CASE("Rounding boost::real::exact_number to a precision in bits") {
+    using exact_number = boost::real::exact_number<int>;
+    const size_t bits_per_digit = exact_number::BITS_PER_DIGIT;
+
+    exact_number a(std::vector<int> {5, 123456789, 7}, 1);
+
+    SECTION("Whole digits behave as up_to") {
+        CHECK(a.up_to_bits(2 * bits_per_digit, false) == a.up_to(2, false));
+        CHECK(a.up_to_bits(2 * bits_per_digit, true) == a.up_to(2, true));
+        CHECK(exact_number::error_bound(2 * bits_per_digit) == exact_number(std::vector<int> {1}, -2));
+    }
+
+    SECTION("A partial digit is rounded to a multiple of a power of two") {
+        int granularity = 1 << (bits_per_digit - 10);
+        int truncated = 123456789 - 123456789 % granularity;
+
+        CHECK(a.up_to_bits(bits_per_digit + 10, false) == exact_number(std::vector<int> {5, truncated}, 1));
+        CHECK(a.up_to_bits(bits_per_digit + 10, true) == exact_number(std::vector<int> {5, truncated + granularity}, 1));
+
+        exact_number b = a;
+        b.positive = false;
+        CHECK(b.up_to_bits(bits_per_digit + 10, true) == exact_number(std::vector<int> {5, truncated}, 1, false));
+        CHECK(b.up_to_bits(bits_per_digit + 10, false) == exact_number(std::vector<int> {5, truncated + granularity}, 1, false));
+    }
+
+    SECTION("Error bounds decrease with the amount of bits") {
+        CHECK(exact_number::error_bound(bits_per_digit + 10) < exact_number::error_bound(bits_per_digit));
+        CHECK(exact_number::error_bound(2 * bits_per_digit) < exact_number::error_bound(bits_per_digit + 10));
+        CHECK(exact_number::digits_for_bits(bits_per_digit + 10) == 2);
+    }
+}
+
+TEST_CASE("Refining boost::real::const_precision_iterator to a precision in bits") {
+    using real = boost::real::real<int>;
+    const size_t bits_per_digit = boost::real::exact_number<int>::BITS_PER_DIGIT;
+
+    SECTION("Operations round to the requested bits") {
+        real a(ones, 1);
+        real b(one_and_max, 1);
+        real c = a * b;
+        real d = a * b;
+
+        auto bits_it = c.get_real_itr();
+        bits_it.refine_to_bits(2 * bits_per_digit + 10);
+        auto digits_it = d.get_real_itr().cbegin();
+        digits_it.iterate_n_times(2);
+
+        CHECK(bits_it.get_precision() == 3);
+        CHECK(bits_it.precision_bits() == 2 * bits_per_digit + 10);
+        CHECK(bits_it.get_interval().lower_bound <= digits_it.get_interval().lower_bound);
+        CHECK(digits_it.get_interval().upper_bound <= bits_it.get_interval().upper_bound);
+
+        ++bits_it;
+        CHECK(bits_it.precision_bits() == 4 * bits_per_digit);
+    }
+
+    SECTION("Kernels stop at the requested bits") {
+        // e has one integral digit, so 15 bits are left for the fractional part
+        real x = real::exp(real("1"));
+        real y = real::exp(real("1"));
+        auto bits_it = x.get_real_itr();
+        bits_it.refine_to_bits(bits_per_digit + 15);
+        auto digits_it = y.get_real_itr();
+        digits_it.iterate_n_times(1);
+
+        CHECK(bits_it.get_interval().width() <= boost::real::exact_number<int>(std::vector<int> {1 << 16}, 0));
+        CHECK(digits_it.get_interval().width() <= bits_it.get_interval().width());
+    }
+}
@@ -0,0 +1,74 @@
+#include <catch2/catch.hpp>
+#include <test_helpers.hpp>
+
+TEST_CASE("Tri-state comparison of boost::real::real numbers") {
+    using real = boost::real::real<int>;
+    using ORDER = boost::real::ORDER;
+
+    SECTION("Separated numbers are ordered by the floating-point filter") {
+        real a("1.5");
+        real b("2.5");
+
+        auto result = boost::real::compare(a, b);
+        CHECK(result.order == ORDER::LESS);
+        CHECK(result.precision == 0);
+        CHECK(boost::real::compare(b, a).order == ORDER::GREATER);
+    }
+
+    SECTION("Rational numbers are compared exactly") {
+        real a("1/3", "rational");
+        real b("2/6", "rational");
+        real c("1/2", "rational");
+
+        CHECK(boost::real::compare(a, b).order == ORDER::EQUAL);
+        CHECK(boost::real::compare(a, c).order == ORDER::LESS);
+        CHECK(boost::real::compare(c, a).order == ORDER::GREATER);
+    }
+
+    SECTION("A number is equal to itself without refining") {
+        real a = real("1") / real("3");
+
+        auto result = a.compare(a);
+        CHECK(result.order == ORDER::EQUAL);
+        CHECK(result.precision == 0);
+    }
+
+    SECTION("Close numbers are refined until they are ordered") {
+        real a({1, 2, 3, 4, 5, 6, 7, 8}, 1);
+        real b({1, 2, 3, 4, 5, 6, 7, 9}, 1);
+
+        auto result = a.compare(b);
+        CHECK(result.order == ORDER::LESS);
+        CHECK(result.precision >= 4);
+        CHECK(b.compare(a).order == ORDER::GREATER);
+        CHECK(a.compare(real({1, 2, 3, 4, 5, 6, 7, 8}, 1)).order == ORDER::EQUAL);
+    }
+
+    SECTION("Comparisons continue from the numbers own refinement") {
+        real a = real("1") / real("3");
+        real b = real("1") / real("3") + real({1}, -5);
+
+        auto result = a.compare(b);
+        CHECK(result.order == ORDER::LESS);
+        CHECK(a.get_real_itr().get_precision() == result.precision);
+
+        // a second comparison does not refine again
+        CHECK(a.compare(b).precision == result.precision);
+        CHECK(a.get_real_itr().get_precision() == result.precision);
+    }
+
+    SECTION("Overlapping numbers are undecided instead of throwing") {
+        real a = real("1") / real("3");
+        real b = real("2") / real("6");
+
+        boost::real::comparison result;
+        CHECK_NOTHROW(result = boost::real::compare(a, b, {3}));
+        CHECK(result.order == ORDER::UNDECIDED);
+        CHECK(result.precision == 3);
+
+        a.set_maximum_precision(3);
+        b.set_maximum_precision(3);
+        CHECK_THROWS_AS(a == b, boost::real::precision_exception);
+        CHECK_THROWS_AS(a < b, boost::real::precision_exception);
+    }
+}
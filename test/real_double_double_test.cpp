@@ -0,0 +1,99 @@
+#include <catch2/catch.hpp>
+#include <test_helpers.hpp>
+
+TEST_CASE("Double-double interval enclosures of boost::real::real numbers") {
+    using real = boost::real::real<int>;
+    using exact_number = boost::real::exact_number<int>;
+    using double_double_interval = boost::real::double_double_interval;
+
+    SECTION("Doubles convert exactly into exact numbers") {
+        CHECK(boost::real::to_exact_number<int>(0.0) == exact_number());
+        CHECK(boost::real::to_exact_number<int>(3.0) == exact_number("3"));
+        CHECK(boost::real::to_exact_number<int>(-0.5) == exact_number(std::vector<int> {536870911}, 0, false));
+
+        double x = 1.0 / 3.0;
+        exact_number exact_x = boost::real::to_exact_number<int>(x);
+        CHECK(exact_x.as_double() == x);
+        CHECK(boost::real::to_exact_number<int>(1e-30).as_double() == Approx(1e-30));
+    }
+
+    SECTION("Explicit numbers are enclosed with more bits than a double") {
+        std::vector<int> digits {1, 1073741821, 7, 5, 3, 1};
+        double_double_interval a = boost::real::enclose_double_double(digits, 2, true);
+        exact_number value(digits, 2);
+
+        CHECK(boost::real::to_exact_number<int>(a.lower) <= value);
+        CHECK(value <= boost::real::to_exact_number<int>(a.upper));
+        // 2^-54, about 2^-84 relative to a number of magnitude 2^30
+        CHECK(boost::real::to_exact_number<int>(a.upper) - boost::real::to_exact_number<int>(a.lower) <= exact_number(std::vector<int> {1 << 6}, -1));
+    }
+
+    SECTION("Numbers close to the bottom of the double range are enclosed") {
+        std::vector<int> digits {536870912, 0, 1, 0, 0, 3};
+        double_double_interval a = boost::real::enclose_double_double(digits, -34, true);
+        CHECK(a.lower.hi <= 4.46e-308);
+        CHECK(a.upper.hi >= 4.45e-308);
+    }
+
+    SECTION("Operations are enclosed from their operands") {
+        real a({1, 2, 3}, 1);
+        real b({7, 5}, 0, false);
+        real c = (a + b) * a - a / b;
+
+        double_double_interval enclosure = c.double_double_enclosure();
+        boost::real::interval<int> exact = c.get_real_itr().cend().get_interval();
+        exact_number lower = boost::real::to_exact_number<int>(enclosure.lower);
+        exact_number upper = boost::real::to_exact_number<int>(enclosure.upper);
+
+        CHECK(lower <= exact.lower_bound);
+        CHECK(exact.upper_bound <= upper);
+        CHECK(upper - lower <= exact_number(std::vector<int> {1}, 0));
+    }
+
+    SECTION("Transcendental functions use their double enclosure") {
+        real e = real::exp(real("1"));
+        double_double_interval enclosure = e.double_double_enclosure();
+
+        CHECK(enclosure.lower.hi == e.double_enclosure().lower);
+        CHECK(enclosure.upper.hi == e.double_enclosure().upper);
+    }
+
+    SECTION("Comparisons too close for doubles are decided by double-double enclosures") {
+        real a("1");
+        real b = real("1") + real({1}, -2); // about 1 + 2^-90, the same double as 1
+
+        CHECK(a.double_enclosure().lower <= b.double_enclosure().upper);
+        CHECK(a.double_double_enclosure() < b.double_double_enclosure());
+        CHECK(a < b);
+        CHECK(b > a);
+        CHECK_FALSE(a == b);
+    }
+
+    SECTION("Low accuracy requests are approximated without refining") {
+        real a({1, 2, 3}, 1);
+        real c = a * a + a;
+
+        auto result = c.approximate(real({1}, -2), boost::real::TOLERANCE::RELATIVE);
+
+        CHECK(result.precision == 0);
+        CHECK(result.enclosure.width() <= result.enclosure.lower_bound * exact_number(std::vector<int> {1}, -1));
+        CHECK(c.get_real_itr().get_precision() == 1);
+    }
+
+    SECTION("Zero valued numbers are approximated from their double-double enclosure") {
+        real zero("0");
+        auto result = zero.approximate(real("0.001"));
+
+        CHECK(result.precision == 0);
+        CHECK(result.enclosure.lower_bound == exact_number());
+        CHECK(result.enclosure.upper_bound == exact_number());
+
+        real a({1, 2, 3}, 1);
+        real difference = a - a;
+        auto difference_result = difference.approximate(real("0.001"));
+
+        CHECK(difference_result.enclosure.lower_bound <= exact_number());
+        CHECK(exact_number() <= difference_result.enclosure.upper_bound);
+        CHECK(difference_result.enclosure.width() <= exact_number("0.001"));
+    }
+}
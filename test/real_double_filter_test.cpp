@@ -0,0 +1,98 @@
+#include <catch2/catch.hpp>
+#include <test_helpers.hpp>
+
+TEST_CASE("Double interval enclosures of boost::real::real numbers") {
+    using real = boost::real::real<int>;
+    using double_interval = boost::real::double_interval;
+
+    SECTION("Explicit numbers are enclosed tightly") {
+        double_interval a = boost::real::enclose(std::vector<int> {1, 1073741821, 7}, 2, true);
+        double value = 1073741822.0 + 1073741821.0 + 7.0 / 1073741822.0;
+        CHECK(a.lower <= value);
+        CHECK(value <= a.upper);
+        CHECK(a.upper - a.lower < 1e-14 * value);
+
+        double_interval b = boost::real::enclose(std::vector<int> {3, 2, 1, 5}, 0, false);
+        CHECK(b.negative());
+        CHECK(b.lower <= -3.0 / 1073741822.0);
+        CHECK(b.upper >= -4.0 / 1073741822.0);
+
+        double_interval zero = boost::real::enclose(std::vector<int> {0, 0}, 0, true);
+        CHECK(zero.lower == 0);
+        CHECK(zero.upper == 0);
+    }
+
+    SECTION("Numbers close to the bottom of the double range are enclosed") {
+        // about 2^-1021, from three digits scaled by base^-37
+        std::vector<int> digits {536870912, 0, 1};
+        double_interval a = boost::real::enclose(digits, -34, true);
+        CHECK(a.lower <= 4.46e-308);
+        CHECK(a.upper >= 4.45e-308);
+
+        // about 2^-1022, just above the smallest normal double
+        real x({536870912, 0, 1}, -34);
+        real y({268435456}, -34);
+        CHECK(x > y);
+        CHECK(y < x);
+        CHECK(boost::real::compare(x, y).order == boost::real::ORDER::GREATER);
+
+        double_interval tiny = boost::real::enclose(std::vector<int> {1}, -400, true);
+        CHECK(tiny.lower == 0);
+        CHECK(tiny.upper > 0);
+        double_interval huge = boost::real::enclose(std::vector<int> {1}, 400, false);
+        CHECK(std::isinf(huge.lower));
+        CHECK(huge.upper == -std::numeric_limits<double>::max());
+    }
+
+    SECTION("Operations are enclosed from their operands") {
+        real a("1.5");
+        real b("-2.25");
+        real c = (a + b) * a - real::exp(a) / b;
+        double value = (1.5 - 2.25) * 1.5 - std::exp(1.5) / -2.25;
+
+        double_interval enclosure = c.double_enclosure();
+        CHECK(enclosure.lower <= value);
+        CHECK(value <= enclosure.upper);
+        CHECK(enclosure.upper - enclosure.lower < 1e-12);
+
+        real s = real::sin(real("3.14159265358979323846"));
+        double_interval sin_enclosure = s.double_enclosure();
+        CHECK(sin_enclosure.lower <= 0);
+        CHECK(0 <= sin_enclosure.upper);
+        CHECK(sin_enclosure.upper - sin_enclosure.lower < 1e-12);
+
+        real x = real::cos(real("0.1") - real("0.1"));
+        double_interval cos_enclosure = x.double_enclosure();
+        CHECK(cos_enclosure.upper == 1);
+        CHECK(cos_enclosure.lower > 0.99);
+    }
+
+    SECTION("Unsupported enclosures are the entire line") {
+        // below the double range, so the divisor enclosure contains zero
+        real q = real("1") / real({1}, -40);
+        CHECK(q.double_enclosure().is_entire());
+
+        real r = q * real("2") + real("1");
+        CHECK(r.double_enclosure().is_entire());
+    }
+
+    SECTION("Comparisons are decided by the filter") {
+        real e = real::exp(real("1"));
+
+        CHECK(e > real("2.718"));
+        CHECK(e < real("2.719"));
+        CHECK_FALSE(e == real("2.718"));
+        CHECK_FALSE(e < real("2.718"));
+        CHECK_FALSE(e > real("2.719"));
+    }
+
+    SECTION("Overlapping enclosures fall back to the exact engine") {
+        real a("1");
+        real b = real("1") + real({1}, -20);
+
+        CHECK(a < b);
+        CHECK(b > a);
+        CHECK_FALSE(a == b);
+        CHECK(a == real("1"));
+    }
+}
@@ -0,0 +1,68 @@
+#include <catch2/catch.hpp>
+#include <test_helpers.hpp>
+
+TEST_CASE("Memory budget of the operands approximation intervals") {
+    using real = boost::real::real<int>;
+    using cache = boost::real::enclosure_cache<int>;
+
+    auto build = [] () {
+        real third = real("1") / real("3");
+        real seventh = real("1") / real("7");
+        return (third + seventh) * (third - seventh) + third * seventh;
+    };
+
+    SECTION("A disabled cache records nothing") {
+        real x = build();
+        auto it = x.get_real_itr();
+        it.iterate_n_times(10);
+        CHECK(cache::size() == 0);
+    }
+
+    SECTION("The operands intervals fit the capacity after an evaluation") {
+        real expected = build();
+        auto expected_it = expected.get_real_itr();
+        expected_it.iterate_n_times(20);
+
+        cache::set_capacity(64);
+        real x = build();
+        auto it = x.get_real_itr();
+        it.iterate_n_times(20);
+        CHECK(cache::size() <= 64);
+
+        // the root keeps its own interval
+        CHECK(it.get_interval() == expected_it.get_interval());
+
+        // evicted operands are evaluated again when more precision is needed
+        it.iterate_n_times(5);
+        expected_it.iterate_n_times(5);
+        CHECK(cache::size() <= 64);
+        CHECK(it.get_interval() == expected_it.get_interval());
+
+        cache::set_capacity(0);
+        CHECK(cache::size() == 0);
+    }
+
+    SECTION("Comparisons are not changed by evictions") {
+        cache::set_capacity(16);
+        real x = build();
+        real y = build() + real("1") / real("1000000");
+
+        CHECK(x < y);
+        CHECK(real("0.1383") < x);
+        CHECK(x < real("0.1384"));
+        CHECK(cache::size() <= 16);
+        cache::set_capacity(0);
+    }
+
+    SECTION("Destroyed operands are forgotten") {
+        cache::set_capacity(1 << 20);
+        {
+            real x = build();
+            auto it = x.get_real_itr();
+            it.iterate_n_times(10);
+            CHECK(cache::size() > 0);
+        }
+        CHECK(cache::size() == 0);
+        cache::set_capacity(0);
+    }
+}
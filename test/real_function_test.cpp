@@ -0,0 +1,110 @@
+#include <catch2/catch.hpp>
+#include <test_helpers.hpp>
+
+TEST_CASE("User defined function nodes") {
+    using real = boost::real::real<int>;
+    using interval = boost::real::interval<int>;
+    using exact_number = boost::real::exact_number<int>;
+    using boost::real::real_function;
+    using boost::real::MONOTONICITY;
+
+    auto constant = [] (const std::string& value) {
+        interval result;
+        result.lower_bound = result.upper_bound = real(value).get_real_itr().cend().get_interval().lower_bound;
+        return result;
+    };
+    auto width = [] (real x, size_t bits) {
+        auto it = x.get_real_itr();
+        it.refine_to_bits(bits);
+        return it.get_interval().width().leading_bit();
+    };
+
+    SECTION("Monotone functions are evaluated at the bounds") {
+        real_function<int> square_root;
+        square_root.monotonicity = MONOTONICITY::INCREASING;
+        bool points = true;
+        square_root.kernel = [&points] (const interval& x, size_t bits) {
+            points = points && x.is_a_number();
+            return boost::real::sqrt(x, bits);
+        };
+
+        real y = boost::real::apply(square_root, real("2"));
+        CHECK(real("1.41421356237") < y);
+        CHECK(y < real("1.41421356238"));
+        CHECK(points);
+
+        real_function<int> opposite;
+        opposite.monotonicity = MONOTONICITY::DECREASING;
+        opposite.kernel = [] (const interval& x, size_t bits) {
+            return boost::real::sub(interval(), x, bits);
+        };
+        real z = boost::real::apply(opposite, real("1") / real("3"));
+        CHECK(real("-0.33334") < z);
+        CHECK(z < real("-0.33333"));
+    }
+
+    SECTION("Lipschitz constants bound crude kernels") {
+        // x (1 - x) on [0, 1], whose kernel only evaluates single numbers
+        real_function<int> logistic;
+        logistic.lipschitz = exact_number(std::vector<int> {1}, 1);
+        logistic.kernel = [constant] (const interval& x, size_t bits) {
+            if (!x.is_a_number()) {
+                interval whole;
+                whole.lower_bound = constant("-1").lower_bound;
+                whole.upper_bound = constant("1").lower_bound;
+                return whole;
+            }
+            return boost::real::mul(x, boost::real::sub(constant("1"), x, bits), bits);
+        };
+
+        real y = boost::real::apply(logistic, real("1") / real("3"));
+        CHECK(real("0.2222") < y);
+        CHECK(y < real("0.2223"));
+        CHECK(width(y, 90) < -80);
+    }
+
+    SECTION("Lipschitz constants plan the precision of the argument") {
+        // x - 0.333, whose result has 10 bits less than its argument
+        auto shift = [constant] (const interval& x, size_t bits) {
+            return boost::real::sub(x, constant("0.333"), bits);
+        };
+        real_function<int> planned;
+        planned.kernel = shift;
+        planned.lipschitz = exact_number(std::vector<int> {1}, 1);
+        real_function<int> unplanned;
+        unplanned.kernel = shift;
+
+        real planned_result = boost::real::apply(planned, real("1") / real("3"));
+        real unplanned_result = boost::real::apply(unplanned, real("1") / real("3"));
+        CHECK(width(planned_result, 60) < width(unplanned_result, 60) - 8);
+    }
+
+    SECTION("Functions are operands") {
+        real_function<int> square;
+        square.kernel = [] (const interval& x, size_t bits) {
+            return boost::real::mul(x, x, bits);
+        };
+        square.monotonicity = MONOTONICITY::INCREASING;
+
+        boost::real::node_table<int>::hash_consing = true;
+        real x("3");
+        real y = boost::real::apply(square, x) + real("1");
+        real_function<int> identity = square;
+        identity.kernel = [] (const interval& x, size_t) {
+            return x;
+        };
+        real z = boost::real::apply(identity, x);
+        CHECK(y == real("10"));
+        CHECK(z == real("3"));
+        boost::real::node_table<int>::hash_consing = false;
+    }
+
+    SECTION("Kernel exceptions are thrown by the evaluation") {
+        real_function<int> square_root;
+        square_root.monotonicity = MONOTONICITY::INCREASING;
+        square_root.kernel = [] (const interval& x, size_t bits) {
+            return boost::real::sqrt(x, bits);
+        };
+        CHECK_THROWS_AS(boost::real::apply(square_root, real("-1")), boost::real::square_root_not_defined_for_negative_number);
+    }
+}
@@ -0,0 +1,71 @@
+#include <catch2/catch.hpp>
+#include <test_helpers.hpp>
+
+TEST_CASE("Hash-consing of boost::real::real nodes") {
+    using real = boost::real::real<int>;
+    using table = boost::real::node_table<int>;
+
+    auto same_node = [] (real& a, real& b) {
+        return &a.get_real_number() == &b.get_real_number();
+    };
+
+    SECTION("Without hash-consing every node is new") {
+        real a = real("2") * real("3");
+        real b = real("2") * real("3");
+        CHECK_FALSE(same_node(a, b));
+    }
+
+    table::hash_consing = true;
+
+    SECTION("Equal leaves and operations are a single node") {
+        real a("2");
+        real b("2");
+        CHECK(same_node(a, b));
+
+        real x = real("1") / real("3");
+        real y = real("1") / real("3");
+        CHECK(same_node(x, y));
+
+        real first = a * x + a * x * real("5");
+        real product = a * x;
+        auto sum = std::get_if<boost::real::real_operation<int>>(&first.get_real_number());
+        REQUIRE(sum != nullptr);
+        CHECK(&sum->lhs()->get_real_number() == &product.get_real_number());
+
+        real s1 = real::sin(x);
+        real s2 = real::sin(y);
+        CHECK(same_node(s1, s2));
+
+        real c("3");
+        CHECK_FALSE(same_node(a, c));
+        real d = a - x;
+        real e = x - a;
+        CHECK_FALSE(same_node(d, e));
+    }
+
+    SECTION("Shared subexpressions are evaluated once") {
+        real x = real("1") / real("7");
+        real y = real("1") / real("7");
+        x.refine();
+        x.refine();
+
+        CHECK(y.get_real_itr().get_precision() == x.get_real_itr().get_precision());
+        CHECK(x == y);
+    }
+
+    SECTION("The table only keeps live nodes") {
+        table::clear();
+        {
+            real x = real("1") / real("9") + real("4");
+            CHECK(table::size() == 5);
+        }
+        CHECK(table::size() == 0);
+
+        real x = real("1") / real("9");
+        real y = real("1") / real("9");
+        CHECK(same_node(x, y));
+    }
+
+    table::hash_consing = false;
+    table::clear();
+}
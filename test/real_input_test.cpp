@@ -0,0 +1,95 @@
+#include <catch2/catch.hpp>
+#include <test_helpers.hpp>
+#include <real/real_input.hpp>
+
+TEST_CASE("Inputs whose value changes") {
+    using real = boost::real::real<int>;
+    using real_input = boost::real::real_input<int>;
+
+    SECTION("The numbers using an input take its new value") {
+        real_input x("2");
+        real y = x * x + real("1");
+        CHECK(y == real("5"));
+
+        x.set("3");
+        CHECK(y == real("10"));
+
+        x.set(real("1") / real("4"));
+        CHECK(y == real("1.0625"));
+
+        x.set("-1.5");
+        CHECK(y == real("3.25"));
+    }
+
+    SECTION("Only the dependent nodes are restarted") {
+        real_input x("1");
+        real c = real("1") / real("3");
+        real y = c * c + x;
+
+        auto it = y.get_real_itr();
+        it.iterate_n_times(5);
+        boost::real::precision_t refined = c.get_real_itr().get_precision();
+        CHECK(refined >= 5);
+
+        x.set("2");
+        CHECK(y.get_real_itr().get_precision() == 1);
+        CHECK(c.get_real_itr().get_precision() == refined);
+
+        CHECK(real("2.1111") < y);
+        CHECK(y < real("2.1112"));
+    }
+
+    SECTION("Shared nodes and several inputs") {
+        real_input a("1");
+        real_input b("2");
+        real s = a + b;
+        real p = s * s - a;
+        real q = s / b;
+        CHECK(p == real("8"));
+        CHECK(q == real("1.5"));
+
+        a.set("3");
+        CHECK(p == real("22"));
+        CHECK(q == real("2.5"));
+
+        b.set("4");
+        CHECK(p == real("46"));
+        CHECK(q == real("1.75"));
+    }
+
+    SECTION("Inputs are not constants") {
+        real_input x("1");
+        real y = x * real("2");
+        real z = (x * real("1")).simplify();
+        x.set("4");
+        CHECK(y == real("8"));
+        CHECK(z == real("4"));
+
+        // rationals are folded with constants, but not with inputs
+        real_input r(real("1", "rational"));
+        real w = r + real("1", "rational");
+        r.set("5");
+        CHECK(w == real("6"));
+
+        // inputs are not shared with the equal leaves
+        boost::real::node_table<int>::hash_consing = true;
+        real_input h("2");
+        real k = h + real("2");
+        h.set("3");
+        CHECK(k == real("5"));
+        CHECK(real("2") + real("2") == real("4"));
+        boost::real::node_table<int>::hash_consing = false;
+    }
+
+    SECTION("Invalid values") {
+        real_input x("1");
+        CHECK_THROWS_AS(x.set(x + real("1")), boost::real::dependent_input_value_exception);
+
+        // a value making a divisor zero is rejected, and the input keeps its value
+        real y = real("1") / x;
+        CHECK(y == real("1"));
+        CHECK_THROWS(x.set("0"));
+        CHECK(y == real("1"));
+        CHECK(x == real("1"));
+    }
+}
@@ -0,0 +1,83 @@
+#include <catch2/catch.hpp>
+#include <test_helpers.hpp>
+
+TEMPLATE_TEST_CASE("Truncated intervals of explicit and algorithmic numbers", "[template]", int, long) {
+    using real = boost::real::real<TestType>;
+    using exact_number = boost::real::exact_number<TestType>;
+    TestType base = (std::numeric_limits<TestType>::max() / 4) * 2 - 1;
+
+    // the width of a truncated interval is one ulp of its last digit, base^exponent
+    auto ulp = [] (int exponent) {
+        return exact_number(std::vector<TestType> {1}, exponent + 1);
+    };
+
+    SECTION("The upper bound carries over the maximum digits") {
+        real x({1, base, base, 7}, 1);
+        auto it = x.get_real_itr();
+        it.iterate_n_times(2);
+
+        CHECK(it.get_interval().lower_bound == exact_number(std::vector<TestType> {1, base, base}, 1));
+        CHECK(it.get_interval().upper_bound == exact_number(std::vector<TestType> {2}, 1));
+        CHECK(it.get_interval().width() == ulp(-2));
+
+        ++it;
+        CHECK(it.get_interval().is_a_number());
+    }
+
+    SECTION("Negative numbers are mirrored") {
+        real x({3, base, 5, 1}, 0, false);
+        auto it = x.get_real_itr();
+        ++it;
+        ++it;
+
+        CHECK(it.get_interval().lower_bound == exact_number(std::vector<TestType> {3, base, 6}, 0, false));
+        CHECK(it.get_interval().upper_bound == exact_number(std::vector<TestType> {3, base, 5}, 0, false));
+        CHECK(it.get_interval().width() == ulp(-3));
+    }
+
+    SECTION("Iterating without reading gives the same intervals") {
+        real x([] (unsigned int n) {
+            return n % 2 == 0 ? (std::numeric_limits<TestType>::max() / 4) * 2 - 1 : (TestType) n;
+        }, 0, false);
+
+        auto stepped = x.get_real_itr();
+        auto jumped = x.get_real_itr();
+        for (int i = 0; i < 6; ++i) {
+            ++stepped;
+            CHECK(stepped.get_interval().width() == ulp(-(i + 2)));
+        }
+        jumped.iterate_n_times(3);
+        jumped.iterate_n_times(3);
+
+        CHECK(stepped == jumped);
+        CHECK(jumped.get_interval().lower_bound < jumped.get_interval().upper_bound);
+    }
+
+    SECTION("Leaves under a sum stay unmaterialized") {
+        using operation = boost::real::real_operation<TestType>;
+
+        real x([] (unsigned int n) { return (TestType) (n + 1); }, 0);
+        real y([] (unsigned int n) { return (TestType) (2 * n + 1); }, 0, false);
+        real sum = x + y;
+        real difference = x - y;
+
+        for (int i = 0; i < 4; ++i) {
+            sum.refine();
+            difference.refine();
+        }
+
+        const operation* sum_operation = std::get_if<operation>(&sum.get_real_number());
+        REQUIRE(sum_operation != nullptr);
+        CHECK(sum_operation->lhs()->get_precision_itr().upper_pending());
+        CHECK(sum_operation->rhs()->get_precision_itr().upper_pending());
+
+        // the bounds built in temporaries are the ones the materialized interval holds
+        auto x_it = x.get_real_itr();
+        auto y_it = y.get_real_itr();
+        CHECK(x_it.get_interval().width() == ulp(-5));
+        CHECK(sum.get_real_itr().get_interval().lower_bound == x_it.get_interval().lower_bound + y_it.get_interval().lower_bound);
+        CHECK(sum.get_real_itr().get_interval().upper_bound == x_it.get_interval().upper_bound + y_it.get_interval().upper_bound);
+        CHECK(difference.get_real_itr().get_interval().lower_bound == x_it.get_interval().lower_bound - y_it.get_interval().upper_bound);
+        CHECK(difference.get_real_itr().get_interval().upper_bound == x_it.get_interval().upper_bound - y_it.get_interval().lower_bound);
+    }
+}
@@ -0,0 +1,72 @@
+#include <catch2/catch.hpp>
+#include <test_helpers.hpp>
+
+TEST_CASE("Materialization of boost::real::real operation trees") {
+    using real = boost::real::real<int>;
+    using table = boost::real::node_table<int>;
+    using ORDER = boost::real::ORDER;
+
+    SECTION("A tree becomes an enclosure leaf holding its interval") {
+        real x = real("1") / real("3");
+        real y = x * x + real("2") * x;
+        CHECK(y.depth() == 4);
+
+        auto expected = y.get_real_itr();
+        expected.iterate_n_times(3);
+
+        real materialized = y;
+        materialized.materialize(4);
+        CHECK(materialized.depth() == 1);
+        CHECK(std::get_if<boost::real::real_enclosure<int>>(&materialized.get_real_number()) != nullptr);
+        CHECK(materialized.get_real_itr().get_interval() == expected.get_interval());
+
+        // the number which shared the tree keeps it
+        CHECK(y.depth() == 4);
+
+        CHECK(real("0.77") < materialized);
+        CHECK(materialized < real("0.78"));
+        CHECK(boost::real::compare(materialized, real("-2")).order == ORDER::GREATER);
+    }
+
+    SECTION("Exact trees become explicit leaves") {
+        real y = real("2") * real("3") + real("1");
+
+        y.materialize();
+        CHECK(std::get_if<boost::real::real_explicit<int>>(&y.get_real_number()) != nullptr);
+        CHECK(y == real("7"));
+    }
+
+    SECTION("Leaves are not modified") {
+        real x("25");
+        auto before = x.get_real_itr();
+
+        x.materialize(3);
+        CHECK(x.get_real_itr() == before);
+    }
+
+    SECTION("A materialized number can not be refined beyond its precision") {
+        real x = real("1") / real("3");
+        real materialized = x;
+        materialized.materialize(3);
+
+        auto result = boost::real::compare(materialized, x, {8});
+        CHECK(result.order == ORDER::UNDECIDED);
+        CHECK(materialized.sign().order == ORDER::GREATER);
+    }
+
+    SECTION("The automatic policy bounds the depth of iterations") {
+        table::automatic_materialization = {8, 4};
+
+        // x = x / 2 + 1 / 3 converges to 2 / 3
+        real x("0");
+        real third = real("1") / real("3");
+        for (int i = 0; i < 100; ++i) {
+            x = x / real("2") + third;
+            CHECK(x.depth() <= 8);
+        }
+        table::automatic_materialization = {};
+
+        CHECK(real("0.6666") < x);
+        CHECK(x < real("0.6667"));
+    }
+}
@@ -0,0 +1,84 @@
+#include <catch2/catch.hpp>
+#include <test_helpers.hpp>
+
+TEMPLATE_TEST_CASE("Exact arithmetic between rational and explicit boost::real::real numbers", "[template]", int, long) {
+    using real = boost::real::real<TestType>;
+    using explicit_number = boost::real::real_explicit<TestType>;
+    using operation = boost::real::real_operation<TestType>;
+    using OPERATION = boost::real::OPERATION;
+
+    auto is_leaf = [] (real& x) {
+        return std::get_if<explicit_number>(&x.get_real_number()) != nullptr;
+    };
+
+    auto is_single_division = [] (real& x) {
+        auto division = std::get_if<operation>(&x.get_real_number());
+        return division != nullptr && division->get_operation() == OPERATION::DIVISION &&
+               std::get_if<explicit_number>(division->lhs()->get_real_ptr()) != nullptr &&
+               std::get_if<explicit_number>(division->rhs()->get_real_ptr()) != nullptr;
+    };
+
+    SECTION("Integers and explicit numbers give explicit leaves") {
+        real integer("5", "integer");
+        real e("2");
+
+        real product = integer * e;
+        real sum = e + integer;
+        real difference = e - integer;
+        CHECK(is_leaf(product));
+        CHECK(is_leaf(sum));
+        CHECK(is_leaf(difference));
+        CHECK(product == real("10"));
+        CHECK(sum == real("7"));
+        CHECK(difference == real("-3"));
+
+        real quotient = e / integer;
+        CHECK(is_single_division(quotient));
+    }
+
+    SECTION("Rationals and explicit numbers give a single division") {
+        real rational("3/4", "rational");
+        real e("2");
+
+        real product = rational * e;
+        real sum = rational + e;
+        real quotient = e / rational;
+        CHECK(is_single_division(product));
+        CHECK(is_single_division(sum));
+        CHECK(is_single_division(quotient));
+
+        CHECK(real("1.4") < product);
+        CHECK(product < real("1.6"));
+        CHECK(real("2.7") < sum);
+        CHECK(sum < real("2.8"));
+        CHECK(real("2.6") < quotient);
+        CHECK(quotient < real("2.7"));
+    }
+
+    SECTION("The sign of negative rationals is kept") {
+        real rational("-3/4", "rational");
+        real e("2");
+
+        real product = rational * e;
+        real difference = e - rational;
+        CHECK(product < real("-1.4"));
+        CHECK(real("-1.6") < product);
+        CHECK(real("2.7") < difference);
+        CHECK(difference < real("2.8"));
+
+        real integer("-5", "integer");
+        CHECK((integer + e) == real("-3"));
+    }
+
+    SECTION("Rationals with operations still build an operation") {
+        real rational("1/3", "rational");
+        real x = real("1") / real("7");
+
+        real sum = rational + x;
+        auto node = std::get_if<operation>(&sum.get_real_number());
+        REQUIRE(node != nullptr);
+        CHECK(node->get_operation() == OPERATION::ADDITION);
+        CHECK(real("0.47") < sum);
+        CHECK(sum < real("0.48"));
+    }
+}
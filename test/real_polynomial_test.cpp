@@ -0,0 +1,81 @@
+#include <catch2/catch.hpp>
+#include <test_helpers.hpp>
+
+TEST_CASE("Polynomial nodes") {
+    using real = boost::real::real<int>;
+    using exact_number = boost::real::exact_number<int>;
+
+    real third = real("1") / real("3");
+    // (1 - x)^3
+    std::vector<real> cube = {real("1"), real("-3"), real("3"), real("-1")};
+
+    SECTION("The polynomial encloses its value") {
+        real p = boost::real::polyval(cube, third);
+        auto it = p.get_real_itr();
+        it.iterate_n_times(4);
+
+        CHECK(it.get_interval().lower_bound.as_double() <= 8.0 / 27 * (1 + 1e-15));
+        CHECK(8.0 / 27 * (1 - 1e-15) <= it.get_interval().upper_bound.as_double());
+        CHECK(real("0.2962") < p);
+        CHECK(p < real("0.2963"));
+    }
+
+    SECTION("The enclosure is tighter than the tree of operations") {
+        real x = third;
+        real tree = cube[0] + cube[1] * x + cube[2] * x * x + cube[3] * x * x * x;
+        real p = boost::real::polyval(cube, third);
+
+        auto tree_it = tree.get_real_itr();
+        auto p_it = p.get_real_itr();
+        tree_it.iterate_n_times(3);
+        p_it.iterate_n_times(3);
+
+        CHECK(p_it.get_interval().width() < tree_it.get_interval().width());
+        CHECK(tree_it.get_interval().lower_bound <= p_it.get_interval().upper_bound);
+        CHECK(p_it.get_interval().lower_bound <= tree_it.get_interval().upper_bound);
+    }
+
+    SECTION("Explicit arguments give exact values") {
+        real p = boost::real::polyval(cube, real("4"));
+        CHECK(p == real("-27"));
+
+        CHECK(boost::real::polyval({real("5")}, third) == real("5"));
+        CHECK(boost::real::polyval({}, third) == real("0"));
+    }
+
+    SECTION("Coefficients are numbers too") {
+        // x / 3 + x^2 / 3 at x = 3
+        real p = boost::real::polyval({real("0"), third, third}, real("3"));
+        CHECK(real("3.9999") < p);
+        CHECK(p < real("4.0001"));
+    }
+
+    SECTION("Hash-consing keeps the polynomials apart") {
+        boost::real::node_table<int>::hash_consing = true;
+        real x("2");
+        real p = boost::real::polyval({real("1"), real("1")}, x);
+        real q = boost::real::polyval({real("1"), real("2")}, x);
+        CHECK(p == real("3"));
+        CHECK(q == real("5"));
+        boost::real::node_table<int>::hash_consing = false;
+    }
+
+    SECTION("Centered form on intervals") {
+        // an interval of 1 / 3 two digits wide
+        auto it = (real("1") / real("3")).get_real_itr();
+        it.iterate_n_times(2);
+        boost::real::interval<int> x = it.get_interval();
+
+        std::vector<boost::real::interval<int>> coefficients;
+        for (real c : cube) {
+            coefficients.push_back(c.get_real_itr().cend().get_interval());
+        }
+        boost::real::interval<int> result = boost::real::polynomial(coefficients, x, 128);
+
+        // the width is of the order of the width of x, times |p'(1/3)| = 4/3
+        exact_number bound = x.width() * exact_number(std::vector<int> {2}, 1);
+        CHECK(result.width() < bound);
+        CHECK(result.lower_bound.as_double() <= 8.0 / 27);
+        CHECK(8.0 / 27 <= result.upper_bound.as_double());
+    }
+}
@@ -0,0 +1,79 @@
+#include <catch2/catch.hpp>
+#include <test_helpers.hpp>
+
+TEST_CASE("Absolute and relative precision of the operation kernels") {
+    using real = boost::real::real<int>;
+    using exact_number = boost::real::exact_number<int>;
+    using PRECISION_MODE = boost::real::PRECISION_MODE;
+    const size_t BITS_PER_DIGIT = exact_number::BITS_PER_DIGIT;
+
+    SECTION("leading_bit and as_double estimate the number magnitude") {
+        exact_number one("1");
+        exact_number small(std::vector<int> {4}, 0);
+        exact_number big(std::vector<int> {1}, 3);
+
+        CHECK(one.leading_bit() == 1);
+        CHECK(small.leading_bit() == 3 - (int) BITS_PER_DIGIT);
+        CHECK(big.leading_bit() == (int) (2 * BITS_PER_DIGIT + 1));
+        CHECK(exact_number("0").leading_bit() == std::numeric_limits<int>::min());
+        CHECK(exact_number(std::vector<int> {12345}, 1, false).as_double() == Approx(-12345));
+        CHECK(exact_number(std::vector<int> {3, 0, 7}, 2).as_double() == Approx(3.0 * 1073741822 + 7.0 / 1073741822));
+    }
+
+    SECTION("Absolute division computes the digits before the digits point too") {
+        exact_number numerator(std::vector<int> {1}, 5);
+        exact_number three("3");
+
+        exact_number relative_lower = numerator;
+        exact_number relative_upper = numerator;
+        relative_lower.divide_vector_bits(three, BITS_PER_DIGIT, false, PRECISION_MODE::RELATIVE);
+        relative_upper.divide_vector_bits(three, BITS_PER_DIGIT, true, PRECISION_MODE::RELATIVE);
+
+        exact_number absolute_lower = numerator;
+        exact_number absolute_upper = numerator;
+        absolute_lower.divide_vector_bits(three, BITS_PER_DIGIT, false, PRECISION_MODE::ABSOLUTE);
+        absolute_upper.divide_vector_bits(three, BITS_PER_DIGIT, true, PRECISION_MODE::ABSOLUTE);
+
+        CHECK(relative_lower * three <= numerator);
+        CHECK(numerator <= relative_upper * three);
+        CHECK(absolute_lower * three <= numerator);
+        CHECK(numerator <= absolute_upper * three);
+
+        CHECK(absolute_upper - absolute_lower < relative_upper - relative_lower);
+        CHECK(absolute_upper - absolute_lower <= exact_number(std::vector<int> {1}, 0));
+    }
+
+    SECTION("Relative exponent of a tiny result keeps its significant digits") {
+        exact_number x(std::vector<int> {50}, 1, false);
+        exact_number eps(std::vector<int> {1 << 10}, 0); // about 2^-20
+
+        exact_number lower = boost::real::exponent(x, 2 * BITS_PER_DIGIT, false, PRECISION_MODE::RELATIVE);
+        exact_number upper = boost::real::exponent(x, 2 * BITS_PER_DIGIT, true, PRECISION_MODE::RELATIVE);
+
+        CHECK(lower.positive);
+        CHECK(lower <= upper);
+        CHECK(upper - lower <= upper * eps);
+        CHECK(lower.as_double() == Approx(1.9287498479639178e-22));
+    }
+
+    SECTION("Relative logarithm close to one keeps its significant digits") {
+        exact_number x = exact_number("1") + exact_number(std::vector<int> {1}, -2);
+        exact_number eps(std::vector<int> {1 << 10}, 0);
+
+        exact_number lower = boost::real::logarithm(x, 2 * BITS_PER_DIGIT, false, PRECISION_MODE::RELATIVE);
+        exact_number upper = boost::real::logarithm(x, 2 * BITS_PER_DIGIT, true, PRECISION_MODE::RELATIVE);
+
+        CHECK(lower.positive);
+        CHECK(lower != exact_number("0"));
+        CHECK(upper - lower <= upper * eps);
+    }
+
+    SECTION("Operation nodes choose the relative mode for results far from one") {
+        real a = real::exp(real("-50"));
+        auto it = a.get_real_itr().cbegin();
+
+        CHECK(it.get_interval().lower_bound.positive);
+        CHECK(it.get_interval().lower_bound != exact_number("0"));
+        CHECK(it.get_interval().lower_bound.as_double() == Approx(1.9287498479639178e-22).epsilon(1e-4));
+    }
+}
@@ -0,0 +1,61 @@
+#include <catch2/catch.hpp>
+#include <test_helpers.hpp>
+
+TEST_CASE("Sign and zero detection of boost::real::real numbers") {
+    using real = boost::real::real<int>;
+    using ORDER = boost::real::ORDER;
+
+    SECTION("Leaves have a known sign") {
+        CHECK(real("2.5").sign().order == ORDER::GREATER);
+        CHECK(real("-2.5").sign().order == ORDER::LESS);
+        CHECK(real("0").sign().order == ORDER::EQUAL);
+        CHECK(real("-3/4", "rational").sign().order == ORDER::LESS);
+        CHECK(real("0/4", "rational").sign().order == ORDER::EQUAL);
+    }
+
+    SECTION("Trees which are zero by their structure are detected without evaluation") {
+        real a = real("1") / real("3");
+        real b = a - a;
+        real c = (real("1") / real("7")) * (real("2") - real("2"));
+
+        auto result = b.sign();
+        CHECK(result.order == ORDER::EQUAL);
+        CHECK(result.precision == 0);
+        CHECK(b.is_zero());
+        CHECK(c.is_zero());
+        CHECK(b.get_real_itr().get_precision() == 1);
+
+        CHECK(real::exp(real("-50")).sign().order == ORDER::GREATER);
+        CHECK((real("2") * real("-3") - real("1")).sign().order == ORDER::LESS);
+    }
+
+    SECTION("Numbers close to zero are refined until zero is excluded") {
+        real tiny = real("1") - real({1, 2, 3, 4, 5, 6, 7}, 1) / real({1, 2, 3, 4, 5, 6, 7}, 1) + real({1}, -4);
+
+        auto result = tiny.sign();
+        CHECK(result.order == ORDER::GREATER);
+        CHECK(result.precision > 1);
+        CHECK_FALSE(tiny.is_zero());
+
+        real negative_tiny = real({1, 2, 3, 4, 5, 6, 8}, 1) * real("-1") + real({1, 2, 3, 4, 5, 6, 7}, 1);
+        CHECK(negative_tiny.sign().order == ORDER::LESS);
+    }
+
+    SECTION("Evaluated zeros are equal to zero") {
+        real zero = real("1.5") - real("0.5") - real("1");
+        CHECK(zero.sign().order == ORDER::EQUAL);
+        CHECK(zero.is_zero());
+    }
+
+    SECTION("The budget gives an undecided sign instead of throwing") {
+        real a = real("1") / real("3");
+        real b = a - real("2") / real("6");
+
+        auto result = b.sign({3});
+        CHECK(result.order == ORDER::UNDECIDED);
+        CHECK(result.precision == 3);
+
+        b.set_maximum_precision(3);
+        CHECK_THROWS_AS(b.is_zero(), boost::real::precision_exception);
+    }
+}
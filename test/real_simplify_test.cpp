@@ -0,0 +1,135 @@
+#include <catch2/catch.hpp>
+#include <test_helpers.hpp>
+#include <real/real_input.hpp>
+
+TEST_CASE("Algebraic simplification of boost::real::real numbers") {
+    using real = boost::real::real<int>;
+    using ORDER = boost::real::ORDER;
+
+    // different trees of the same irrational value cannot be decided equal, so they are only
+    // checked not to be separated at a few precisions
+    auto equivalent = [] (const real& a, const real& b) {
+        ORDER order = boost::real::compare(a, b, {6}).order;
+        return order == ORDER::EQUAL || order == ORDER::UNDECIDED;
+    };
+
+    SECTION("Identity elements are removed") {
+        real x = real("1") / real("3");
+
+        CHECK((x + real("0")).simplify().get_real_itr() == x.get_real_itr());
+        CHECK((real("0") + x).simplify().get_real_itr() == x.get_real_itr());
+        CHECK((x * real("1")).simplify().get_real_itr() == x.get_real_itr());
+        CHECK((x / real("1")).simplify().get_real_itr() == x.get_real_itr());
+        CHECK((x * real("0")).simplify() == real("0"));
+        CHECK((x * real("0")).simplify().get_real_itr().get_interval().is_a_number());
+    }
+
+    SECTION("Products by zero keep the errors of their other operand") {
+        // the logarithm is defined when the numbers are simplified, and the input change then
+        // makes the kept logarithm nodes throw when they are evaluated again
+        using real_input = boost::real::real_input<int>;
+        real_input x("2"), y("2"), z("2");
+        real product = (real::log(x) * real("0")).simplify();
+        real reversed = (real("0") * real::log(y)).simplify();
+        real power = real::power(real::log(z), real("0")).simplify();
+        CHECK(product == real("0"));
+        CHECK(reversed == real("0"));
+        CHECK(power == real("1"));
+
+        CHECK_THROWS_AS(x.set("-2"), boost::real::logarithm_not_defined_for_non_positive_number);
+        CHECK_THROWS_AS(y.set("-2"), boost::real::logarithm_not_defined_for_non_positive_number);
+        CHECK_THROWS_AS(z.set("-2"), boost::real::logarithm_not_defined_for_non_positive_number);
+    }
+
+    SECTION("Self cancellations keep the errors of their operand") {
+        using real_input = boost::real::real_input<int>;
+        real_input x("2"), y("2");
+        real difference = (real::log(x) - real::log(x)).simplify();
+        real sum = (real::log(y) + real("1") - real::log(y)).simplify();
+        // the logarithms are kept, so the differences are not single numbers
+        CHECK_FALSE(difference.get_real_itr().get_interval().is_a_number());
+        CHECK_FALSE(sum.get_real_itr().get_interval().is_a_number());
+        CHECK(equivalent(sum, real("1")));
+
+        CHECK_THROWS_AS(x.set("-2"), boost::real::logarithm_not_defined_for_non_positive_number);
+        CHECK_THROWS_AS(y.set("-2"), boost::real::logarithm_not_defined_for_non_positive_number);
+    }
+
+    SECTION("Self cancellations are replaced by constants") {
+        real x = real("1") / real("3");
+
+        real difference = (x - x).simplify();
+        CHECK(difference.get_real_itr().get_interval().is_a_number());
+        CHECK(difference == real("0"));
+
+        real quotient = (x / x).simplify();
+        CHECK(quotient.get_real_itr().get_interval().is_a_number());
+        CHECK(quotient == real("1"));
+
+        // equal subtrees built apart are recognized as well
+        real y = ((real("2") + x) - (real("2") + x)).simplify();
+        CHECK(y.get_real_itr().get_interval().is_a_number());
+        CHECK(y == real("0"));
+    }
+
+    SECTION("Constants are folded exactly") {
+        real x = real("1") / real("7");
+
+        real sum = (real("15") + x + real("9") - real("4")).simplify();
+        CHECK(equivalent(sum, real("20") + x));
+        CHECK_FALSE(equivalent(sum, real("21") + x));
+
+        real product = (real("2") * x * real("3")).simplify();
+        CHECK(equivalent(product, real("6") * x));
+
+        real constant = (real("5") * real("4") - real("15")).simplify();
+        CHECK(constant.get_real_itr().get_interval().is_a_number());
+        CHECK(constant == real("5"));
+    }
+
+    SECTION("Repeated terms and common factors are combined") {
+        real x = real("1") / real("3");
+        real a = real("2") / real("7");
+        real b = real("3") / real("11");
+
+        real twice = (x + x + x - x).simplify();
+        CHECK(equivalent(twice, real("2") * x));
+
+        real factored = (x * a + b * x).simplify();
+        CHECK(equivalent(factored, (a + b) * x));
+
+        real bare = (x * a + x).simplify();
+        CHECK(equivalent(bare, (a + real("1")) * x));
+        CHECK(std::get<boost::real::real_operation<int>>(bare.get_real_number()).get_operation() == boost::real::OPERATION::MULTIPLICATION);
+
+        real bare_difference = (x - a * x).simplify();
+        CHECK(equivalent(bare_difference, (real("1") - a) * x));
+        CHECK(std::get<boost::real::real_operation<int>>(bare_difference.get_real_number()).get_operation() == boost::real::OPERATION::MULTIPLICATION);
+
+        real cancelled = (x * a - a * x).simplify();
+        CHECK(cancelled.get_real_itr().get_interval().is_a_number());
+        CHECK(cancelled == real("0"));
+    }
+
+    SECTION("Long chains are rebalanced and keep their value") {
+        real chain("0");
+        for (int i = 1; i <= 32; ++i) {
+            chain = chain + real("1") / real(std::to_string(i));
+        }
+
+        real simplified = chain.simplify();
+        CHECK(equivalent(simplified, chain));
+        CHECK(simplified.double_enclosure().upper - simplified.double_enclosure().lower <=
+              chain.double_enclosure().upper - chain.double_enclosure().lower);
+    }
+
+    SECTION("The original number is not modified") {
+        real x = real("1") / real("3");
+        real difference = x - x;
+        auto before = difference.get_real_itr();
+
+        difference.simplify();
+        CHECK(difference.get_real_itr() == before);
+        CHECK(std::get_if<boost::real::real_operation<int>>(&difference.get_real_number()) != nullptr);
+    }
+}
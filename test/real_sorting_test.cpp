@@ -0,0 +1,139 @@
+#include <catch2/catch.hpp>
+#include <test_helpers.hpp>
+#include <real/sorting.hpp>
+
+TEST_CASE("Sorting and selection over ranges of boost::real::real numbers") {
+    using real = boost::real::real<int>;
+
+    auto close_numbers = [] () {
+        // separated by the filters, except the three that only differ in their last digits
+        return std::vector<real> {
+            real("5"),
+            real({1, 2, 3, 4, 5, 6, 9}, 1),
+            real("-2.5"),
+            real({1, 2, 3, 4, 5, 6, 7}, 1),
+            real("1") / real("3"),
+            real({1, 2, 3, 4, 5, 6, 8}, 1),
+            real("0"),
+        };
+    };
+
+    SECTION("sort orders the numbers") {
+        std::vector<real> numbers = close_numbers();
+        boost::real::sort(numbers.begin(), numbers.end());
+
+        for (size_t i = 1; i < numbers.size(); ++i) {
+            CHECK(numbers[i - 1] < numbers[i]);
+        }
+        CHECK(numbers.front() == real("-2.5"));
+        CHECK(numbers[3] == real({1, 2, 3, 4, 5, 6, 7}, 1));
+        CHECK(numbers[5] == real({1, 2, 3, 4, 5, 6, 9}, 1));
+        CHECK(numbers.back() == real("5"));
+    }
+
+    SECTION("sort only refines the numbers which overlap") {
+        std::vector<real> numbers = close_numbers();
+        boost::real::sort(numbers.begin(), numbers.end());
+
+        CHECK(numbers[0].get_real_itr().get_precision() == 1);
+        CHECK(numbers[6].get_real_itr().get_precision() == 1);
+        CHECK(numbers[3].get_real_itr().get_precision() > 1);
+    }
+
+    SECTION("sort keeps equal numbers next to each other") {
+        std::vector<real> numbers {real("2"), real("1"), real("2"), real("1/2", "rational"), real("0.5")};
+        boost::real::sort(numbers.begin(), numbers.end());
+
+        CHECK(numbers[0] == real("0.5"));
+        CHECK(numbers[1] == real("0.5"));
+        CHECK(numbers[2] == real("1"));
+        CHECK(numbers[3] == real("2"));
+        CHECK(numbers[4] == real("2"));
+    }
+
+    SECTION("min_element and max_element return the first extremum") {
+        std::vector<real> numbers = close_numbers();
+
+        CHECK(boost::real::min_element(numbers.begin(), numbers.end()) == numbers.begin() + 2);
+        CHECK(boost::real::max_element(numbers.begin(), numbers.end()) == numbers.begin());
+
+        std::vector<real> equal {real("3"), real("1"), real("3"), real("1")};
+        CHECK(boost::real::min_element(equal.begin(), equal.end()) == equal.begin() + 1);
+        CHECK(boost::real::max_element(equal.begin(), equal.end()) == equal.begin());
+
+        std::vector<real> empty;
+        CHECK(boost::real::min_element(empty.begin(), empty.end()) == empty.end());
+    }
+
+    SECTION("nth_element places the nth number") {
+        std::vector<real> numbers = close_numbers();
+        auto nth = numbers.begin() + 4;
+        boost::real::nth_element(numbers.begin(), nth, numbers.end());
+
+        CHECK(*nth == real({1, 2, 3, 4, 5, 6, 8}, 1));
+        for (auto it = numbers.begin(); it != nth; ++it) {
+            CHECK(*it < *nth);
+        }
+        CHECK(*nth < numbers.back());
+    }
+
+    SECTION("partition moves the numbers lower than the pivot first") {
+        std::vector<real> numbers = close_numbers();
+        real pivot({1, 2, 3, 4, 5, 6, 8}, 1);
+        auto middle = boost::real::partition(numbers.begin(), numbers.end(), pivot);
+
+        CHECK(middle - numbers.begin() == 4);
+        for (auto it = numbers.begin(); it != middle; ++it) {
+            CHECK(*it < pivot);
+        }
+        for (auto it = middle; it != numbers.end(); ++it) {
+            CHECK_FALSE(*it < pivot);
+        }
+        // the relative order is kept
+        CHECK(numbers[0] == real("-2.5"));
+        CHECK(numbers[4] == real("5"));
+    }
+
+    SECTION("Copies of an inexact number are equal without refining them to the maximum precision") {
+        real x = real("1") / real("3");
+        std::vector<real> numbers {x, real("2"), x, real("0.5")};
+
+        boost::real::sort(numbers.begin(), numbers.end());
+        CHECK(numbers[0] == x);
+        CHECK(numbers[1] == x);
+        CHECK(numbers[2] == real("0.5"));
+        CHECK(numbers[3] == real("2"));
+
+        std::vector<real> copies {x, real("2"), x};
+        CHECK(boost::real::min_element(copies.begin(), copies.end()) == copies.begin());
+        CHECK(boost::real::max_element(copies.begin(), copies.end()) == copies.begin() + 1);
+
+        std::vector<real> same {x, x, x};
+        boost::real::sort(same.begin(), same.end());
+        CHECK(boost::real::min_element(same.begin(), same.end()) == same.begin());
+        CHECK(x.get_real_itr().get_precision() < x.get_real_itr().maximum_precision());
+    }
+
+    SECTION("partition with a pivot taken from the range") {
+        real x = real("1") / real("3");
+        std::vector<real> numbers {x, real("2"), x, real("-1"), real("0.5")};
+        auto middle = boost::real::partition(numbers.begin(), numbers.end(), x);
+
+        CHECK(middle - numbers.begin() == 1);
+        CHECK(numbers[0] == real("-1"));
+        CHECK(numbers[1] == x);
+        CHECK(numbers[2] == real("2"));
+        CHECK(numbers[3] == x);
+        CHECK(numbers[4] == real("0.5"));
+    }
+
+    SECTION("Different numbers overlapping at the maximum precision throw") {
+        real a = real("1") / real("3");
+        real b = real("2") / real("6");
+        a.set_maximum_precision(3);
+        b.set_maximum_precision(3);
+        std::vector<real> numbers {a, b};
+
+        CHECK_THROWS_AS(boost::real::sort(numbers.begin(), numbers.end()), boost::real::precision_exception);
+    }
+}
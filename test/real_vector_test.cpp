@@ -0,0 +1,77 @@
+#include <catch2/catch.hpp>
+#include <test_helpers.hpp>
+#include <real/real_vector.hpp>
+
+TEST_CASE("Evaluation of one expression over columns of numbers") {
+    using real = boost::real::real<int>;
+    using real_vector = boost::real::real_vector<int>;
+
+    auto column = [] (int first, int last) {
+        std::vector<real> numbers;
+        for (int k = first; k <= last; k++) {
+            numbers.push_back(real(std::to_string(k)));
+        }
+        return real_vector(numbers);
+    };
+
+    SECTION("Integer rows are exact") {
+        real_vector a = column(1, 50);
+        real_vector b = column(101, 150);
+        real_vector expression = a * b - a + real("7");
+
+        auto rows = expression.evaluate(64);
+        REQUIRE(rows.size() == 50);
+        for (int k = 1; k <= 50; k++) {
+            CHECK(rows[k - 1].is_a_number());
+            CHECK(real(boost::real::real_explicit<int>(rows[k - 1].lower_bound)) == real(std::to_string(k * (k + 100) - k + 7)));
+        }
+    }
+
+    SECTION("Rows are tight enclosures of the row expressions") {
+        real_vector k = column(1, 30);
+        real_vector expression = real("1") / k + k / real("3");
+
+        auto rows = expression.evaluate(100);
+        REQUIRE(rows.size() == 30);
+        for (int i = 0; i < 30; i++) {
+            double value = 1.0 / (i + 1) + (i + 1) / 3.0;
+            CHECK(rows[i].lower_bound.as_double() <= value * (1 + 1e-15));
+            CHECK(value * (1 - 1e-15) <= rows[i].upper_bound.as_double());
+
+            int magnitude = std::max(rows[i].upper_bound.leading_bit(), 0);
+            CHECK(rows[i].width().leading_bit() <= magnitude - 100);
+
+            // the row is the same number as its own expression
+            real row = expression[i];
+            auto it = row.get_real_itr();
+            it.iterate_n_times(4);
+            CHECK(it.get_interval().lower_bound <= rows[i].upper_bound);
+            CHECK(rows[i].lower_bound <= it.get_interval().upper_bound);
+        }
+    }
+
+    SECTION("Rows which need more precision are refined") {
+        real third = real("1") / real("3");
+        // the second row cancels its leading digits, so it needs more precision than the first one
+        real_vector x(std::vector<real> {real("5"), third + real("1") / real("1000000000000")});
+        real_vector expression = (x - real_vector(third)) * real("1000000000000");
+
+        auto rows = expression.evaluate(64);
+        CHECK(rows[0].lower_bound.as_double() == Approx(14000000000000.0 / 3));
+        CHECK(rows[1].lower_bound.as_double() == Approx(1.0));
+        CHECK(rows[1].width().leading_bit() <= 1 - 64);
+    }
+
+    SECTION("Operands sizes must match") {
+        CHECK_THROWS_AS(column(1, 3) + column(1, 4), boost::real::real_vector_size_mismatch_exception);
+        CHECK((column(1, 3) + real("1")).size() == 3);
+    }
+
+    SECTION("Divisors containing zero at the maximum precision") {
+        real third = real("1") / real("3");
+        real_vector x(std::vector<real> {real("1"), third});
+        real_vector expression = real("1") / (x - real_vector(third));
+
+        CHECK_THROWS_AS(expression.evaluate(32), boost::real::divergent_division_result_exception);
+    }
+}
@@ -0,0 +1,119 @@
+#include <catch2/catch.hpp>
+#include <test_helpers.hpp>
+#include <real/irrationals.hpp>
+#include <real/snapshot.hpp>
+
+TEST_CASE("Snapshots of evaluated numbers") {
+    using real = boost::real::real<int>;
+    using snapshot = boost::real::snapshot<int>;
+
+    auto restored = [] (const real& x) {
+        std::stringstream stream(std::ios::in | std::ios::out | std::ios::binary);
+        snapshot::write(stream, x);
+        return snapshot::read(stream);
+    };
+    auto refine = [] (const real& x, int times) {
+        for (int k = 0; k < times; k++) {
+            x.refine();
+        }
+    };
+
+    SECTION("Restored numbers resume their refinement") {
+        real third = real("1") / real("3");
+        real x = (third + real("2")) * (real("1") / real("7")) - third * third;
+        refine(x, 5);
+        auto saved = x.get_real_itr();
+
+        real y = restored(x);
+        auto resumed = y.get_real_itr();
+        CHECK(resumed.get_precision() == saved.get_precision());
+        CHECK(resumed.get_interval() == saved.get_interval());
+
+        // the next precisions agree with the original number
+        saved.iterate_n_times(3);
+        resumed.iterate_n_times(3);
+        CHECK(resumed.get_precision() == saved.get_precision());
+        CHECK(resumed.get_interval() == saved.get_interval());
+        CHECK(real("0.2222") < y);
+        CHECK(y < real("0.2223"));
+    }
+
+    SECTION("Leaves and operations") {
+        real rational = real("1/3", "rational") + real("1/6", "rational");
+        CHECK(restored(rational) == real("0.5"));
+
+        real integer("-12345678901234567890");
+        CHECK(restored(integer) == integer);
+
+        real x("2.5");
+        real p = boost::real::polyval({real("1"), real("-3"), real("2")}, x);
+        CHECK(restored(p) == real("6"));
+
+        real e = real::exp(real("1"));
+        refine(e, 2);
+        real restored_e = restored(e);
+        CHECK(real("2.71828182845") < restored_e);
+        CHECK(restored_e < real("2.71828182846"));
+    }
+
+    SECTION("Shared nodes") {
+        real a = real("1") / real("3");
+        real b = a * a + a;
+        real c = b - a;
+
+        std::stringstream shared(std::ios::in | std::ios::out | std::ios::binary);
+        snapshot::write(shared, {b, c});
+        std::stringstream separate(std::ios::in | std::ios::out | std::ios::binary);
+        snapshot::write(separate, b);
+        snapshot::write(separate, c);
+        CHECK(shared.str().size() < separate.str().size());
+
+        std::vector<real> numbers = snapshot::read_all(shared);
+        REQUIRE(numbers.size() == 2);
+        CHECK(real("0.4444") < numbers[0]);
+        CHECK(numbers[0] < real("0.4445"));
+        CHECK(real("0.1111") < numbers[1]);
+        CHECK(numbers[1] < real("0.1112"));
+    }
+
+    SECTION("Maximum precisions are kept") {
+        real x = real("1") / real("7");
+        x.set_maximum_precision(4);
+        CHECK(restored(x).maximum_precision() == 4);
+    }
+
+    SECTION("Nodes defined by code are restored at their interval") {
+        real pi = boost::real::irrational::PI<int>;
+        refine(pi, 3);
+        auto saved = pi.get_real_itr();
+
+        real restored_pi = restored(pi);
+        auto it = restored_pi.get_real_itr();
+        CHECK(it.get_interval() == saved.get_interval());
+        it.iterate_n_times(2);
+        CHECK(it.get_interval() == saved.get_interval());
+        CHECK(real("3.14159") < restored_pi + real("0"));
+    }
+
+    SECTION("Invalid snapshots") {
+        std::stringstream empty(std::ios::in | std::ios::out | std::ios::binary);
+        CHECK_THROWS_AS(snapshot::read(empty), boost::real::invalid_snapshot_exception);
+
+        std::stringstream text("not a snapshot", std::ios::in | std::ios::binary);
+        CHECK_THROWS_AS(snapshot::read(text), boost::real::invalid_snapshot_exception);
+
+        std::stringstream stream(std::ios::in | std::ios::out | std::ios::binary);
+        snapshot::write(stream, real("1") / real("3"));
+        std::string bytes = stream.str();
+
+        std::stringstream truncated(bytes.substr(0, bytes.size() - 5), std::ios::in | std::ios::binary);
+        CHECK_THROWS_AS(snapshot::read(truncated), boost::real::invalid_snapshot_exception);
+
+        std::stringstream other_type(bytes, std::ios::in | std::ios::binary);
+        CHECK_THROWS_AS(boost::real::snapshot<long>::read(other_type), boost::real::invalid_snapshot_exception);
+
+        std::stringstream two(std::ios::in | std::ios::out | std::ios::binary);
+        snapshot::write(two, {real("1"), real("2")});
+        CHECK_THROWS_AS(snapshot::read(two), boost::real::invalid_snapshot_exception);
+    }
+}
@@ -0,0 +1,89 @@
+#include <catch2/catch.hpp>
+#include <test_helpers.hpp>
+#include <real/static_real.hpp>
+
+using boost::real::ROUNDING;
+
+// the kernels are usable in constant expressions
+static_assert(boost::real::static_real<2>(6) * boost::real::static_real<2>(7) == boost::real::static_real<2>(42));
+static_assert(boost::real::static_real<2>(5) - boost::real::static_real<2>(8) < boost::real::static_real<2>(0));
+static_assert((boost::real::static_real<1>(1 << 29) * boost::real::static_real<1>(4)).exponent() == 2);
+
+TEMPLATE_TEST_CASE("Fixed precision static_real numbers", "[template]", int, long) {
+    using real = boost::real::real<TestType>;
+    using exact_number = boost::real::exact_number<TestType>;
+    using static_real = boost::real::static_real<3, TestType>;
+    TestType base = (std::numeric_limits<TestType>::max() / 4) * 2 - 1;
+
+    SECTION("Integer arithmetic is exact") {
+        static_real a(123456789);
+        static_real b(-98765);
+
+        CHECK((a + b).to_real() == real("123358024"));
+        CHECK((a - b).to_real() == real("123555554"));
+        CHECK((a * b).to_real() == real("-12193209765585"));
+        CHECK((b - b).is_zero());
+        CHECK(-(-a) == a);
+        CHECK(b < a);
+    }
+
+    SECTION("The rounding direction gives an enclosure") {
+        real third = real("1") / real("3");
+
+        static_real lower = static_real(real("1"), ROUNDING::DOWNWARD) / static_real(3);
+        static_real upper = static_real(real("1"), ROUNDING::UPWARD) / static_real(3);
+        static_real truncated = static_real(third, ROUNDING::TOWARD_ZERO);
+
+        CHECK(lower < upper);
+        CHECK(lower == truncated);
+        CHECK(lower.to_real() < third);
+        CHECK(third < upper.to_real());
+
+        // the bounds are one unit of the last digit apart
+        static_real unit(exact_number(std::vector<TestType> {1}, lower.exponent() - 2));
+        CHECK(lower + unit == upper);
+
+        CHECK(static_real(third, ROUNDING::DOWNWARD) == lower);
+        CHECK(static_real(third, ROUNDING::UPWARD) == upper);
+        CHECK(static_real(real("0") - third, ROUNDING::UPWARD) == -lower);
+    }
+
+    SECTION("Digits beyond the precision round in the rounding direction") {
+        static_real large(exact_number(std::vector<TestType> {1}, 3), ROUNDING::UPWARD);
+        static_real tiny(exact_number(std::vector<TestType> {1}, -5));
+
+        CHECK(large + tiny > large);
+        CHECK(large - tiny == large);
+
+        static_real down(exact_number(std::vector<TestType> {1}, 3), ROUNDING::DOWNWARD);
+        CHECK(down + tiny == down);
+        CHECK(down - tiny < down);
+        CHECK(down - tiny + tiny < down + tiny);
+
+        static_real truncated(exact_number(std::vector<TestType> {1, 2, 3, 4}, 0), ROUNDING::TOWARD_ZERO);
+        CHECK(truncated.to_exact() == exact_number(std::vector<TestType> {1, 2, 3}, 0));
+    }
+
+    SECTION("Rounding up carries over the maximum digits") {
+        static_real x(exact_number(std::vector<TestType> {base, base, base, 1}, 0), ROUNDING::UPWARD);
+
+        CHECK(x.exponent() == 1);
+        CHECK(x.to_exact() == exact_number(std::vector<TestType> {1}, 1));
+
+        static_real y(exact_number(std::vector<TestType> {base, base, base, 1}, 0, false), ROUNDING::UPWARD);
+        CHECK(y.to_exact() == exact_number(std::vector<TestType> {base, base, base}, 0, false));
+    }
+
+    SECTION("Products of maximum digits") {
+        static_real x(exact_number(std::vector<TestType> {base, base, base}, 0));
+
+        // (1 - u)^2 = 1 - 2u + u^2 with u = base^-3
+        static_real product = x * x;
+        CHECK(product.to_exact() == exact_number(std::vector<TestType> {base, base, base - 1}, 0));
+        CHECK(static_real(x.to_real() * x.to_real(), ROUNDING::DOWNWARD) == product);
+    }
+
+    SECTION("Division by zero") {
+        CHECK_THROWS_AS(static_real(1) / static_real(0), boost::real::divide_by_zero);
+    }
+}